@@ -0,0 +1,45 @@
+#include "catalogue_versions.h"
+
+namespace transport_catalogue
+{
+
+// ----------- CatalogueVersions ---------------
+
+CatalogueVersions::CatalogueVersions(TransportCatalogue& tc) : tc_(tc)
+{
+	// Изменения, накопленные до первой версии, в ней уже учтены
+	tc_.TakeChanges();
+	std::atomic_store(&current_, FrozenCataloguePtr(std::make_shared<const FrozenCatalogue>(tc_)));
+	version_.store(1, std::memory_order_release);
+}
+
+
+FrozenCataloguePtr CatalogueVersions::Acquire() const
+{
+	return std::atomic_load(&current_);
+}
+
+
+uint64_t CatalogueVersions::GetVersion() const
+{
+	return version_.load(std::memory_order_acquire);
+}
+
+
+CatalogueChanges CatalogueVersions::Publish()
+{
+	std::lock_guard<std::mutex> guard(writer_mutex_);
+	const CatalogueChanges changes = tc_.TakeChanges();
+	if (!changes.Any())
+	{
+		return changes;
+	}
+	// Новая версия строится, пока читатели работают со старой. Писатель - единственный,
+	// кто меняет current_, поэтому читать его здесь можно без атомарной загрузки
+	FrozenCataloguePtr next = std::make_shared<const FrozenCatalogue>(tc_, *current_, changes);
+	std::atomic_store(&current_, std::move(next));
+	version_.fetch_add(1, std::memory_order_acq_rel);
+	return changes;
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+ * Назначение модуля: публикация версий каталога для одновременной работы читателей и писателя.
+ *
+ * Писатель меняет TransportCatalogue и публикует новую неизменяемую версию - снимок
+ * FrozenCatalogue. Указатель на текущую версию заменяется атомарно, поэтому читатель видит
+ * либо старую версию целиком, либо новую целиком, но никогда - частично примененное изменение.
+ * Читатель захватывает версию (shared_ptr) и работает с ней без блокировок писателя сколько
+ * угодно долго. Освобождение старой версии - подсчет ссылок: версия удаляется, когда ее
+ * отпустил последний читатель. Данные, не затронутые изменением (координаты остановок,
+ * расстояния), новая версия разделяет с предыдущей.
+ *
+ * Писатель меняет каталог напрямую (каталог меняет один поток) и вызывает Publish(), когда
+ * изменения нужно показать читателям: так несколько изменений подряд дают одну версию.
+ * Публикации сериализуются мьютексом, читатели его не берут.
+ */
+
+#pragma once
+
+#include "frozen_catalogue.h"
+#include "transport_catalogue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace transport_catalogue
+{
+
+using FrozenCataloguePtr = std::shared_ptr<const FrozenCatalogue>;
+
+// ----------- CatalogueVersions ---------------
+
+class CatalogueVersions
+{
+public:
+	// Публикует первую версию заполненного каталога. Дальше каталог меняет только писатель
+	explicit CatalogueVersions(TransportCatalogue&);
+
+	// ЧИТАТЕЛЬ. Захватывает текущую версию. Версия живет, пока жив хотя бы один ее указатель
+	FrozenCataloguePtr Acquire() const;
+	// Номер текущей версии (первая версия - 1)
+	uint64_t GetVersion() const;
+
+	// ПИСАТЕЛЬ. Публикует изменения, внесенные в каталог с прошлой публикации. Возвращает
+	// изменения, примененные в новой версии (пустые - версия не менялась)
+	CatalogueChanges Publish();
+
+private:
+
+	TransportCatalogue& tc_;
+	std::mutex writer_mutex_;              // Только для публикаций
+	FrozenCataloguePtr current_;           // Доступ только через std::atomic_load / std::atomic_store
+	std::atomic<uint64_t> version_{ 0 };
+};
+
+}
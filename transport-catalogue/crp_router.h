@@ -0,0 +1,700 @@
+#pragma once
+
+/*
+ * Маршрутизатор в стиле Customizable Route Planning (CRP).
+ *
+ * Подготовка разделена на две фазы:
+ *  1. Метрико-независимое многоуровневое разбиение вершин на вложенные ячейки (Partition).
+ *     Строится один раз (в режиме make_base) и не зависит от весов ребер.
+ *  2. Кастомизация (Customize): для каждой ячейки каждого уровня вычисляется клика
+ *     кратчайших расстояний между ее входными и выходными граничными вершинами.
+ *     При изменении метрики (скорость автобуса, время ожидания) пересчитывается только она.
+ *
+ * Запрос - двунаправленный многоуровневый Дейкстра: вдали от ячеек начальной и конечной
+ * вершин поиск идет по кликам верхних уровней, а не по исходным ребрам графа.
+ * Буферы поиска принадлежат роутеру и сбрасываются по списку посещенных вершин, поэтому
+ * запрос стоит порядка просмотренных им вершин, а не всего графа. Из-за общих буферов
+ * одновременные запросы к одному роутеру не допускаются.
+ */
+
+#include "graph.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace graph
+{
+
+// Многоуровневое разбиение вершин графа.
+// cells[l][v] - номер ячейки уровня l + 1, содержащей вершину v.
+// Ячейки вложены: вершины одной ячейки уровня l всегда лежат в одной ячейке уровня l + 1
+struct Partition
+{
+    std::vector<std::vector<uint32_t>> cells;
+
+    size_t GetLevelsCount() const
+    {
+        return cells.size();
+    }
+};
+
+template <typename Weight>
+class CrpRouter
+{
+private:
+    using Graph = DirectedWeightedGraph<Weight>;
+
+public:
+    CrpRouter(const Graph& graph, Partition partition);
+
+    struct RouteInfo
+    {
+        Weight weight;
+        std::vector<EdgeId> edges;
+    };
+
+    // Пересчитывает клики оверлея по текущим весам графа (разбиение не меняется)
+    void Customize();
+
+    std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+
+    // Записывает ребра маршрута в буфер вызывающей стороны (буфер очищается, его емкость
+    // переиспользуется). Возвращает вес маршрута или nullopt, если маршрута нет
+    std::optional<Weight> BuildRoute(VertexId from, VertexId to, std::vector<EdgeId>& edges) const;
+
+    // Добавляет в отчет память разбиения, обратных списков смежности и клик оверлея
+    void ReportMemory(memory_report::MemoryReport& report) const;
+
+private:
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+    static constexpr Weight ZERO_WEIGHT{};
+
+    // Ячейка одного уровня разбиения
+    struct Cell
+    {
+        std::vector<VertexId> entries;                // Входные граничные вершины (есть входящее ребро извне)
+        std::vector<VertexId> exits;                  // Выходные граничные вершины (есть исходящее ребро наружу)
+        std::vector<std::optional<Weight>> clique;    // Матрица entries.size() x exits.size()
+
+        const std::optional<Weight>& GetShortcut(size_t entry, size_t exit) const
+        {
+            return clique[entry * exits.size() + exit];
+        }
+    };
+
+    // Уровень разбиения
+    struct Level
+    {
+        std::vector<Cell> cells;
+        std::vector<uint32_t> entry_index;    // Для каждой вершины - индекс среди входов своей ячейки или NONE
+        std::vector<uint32_t> exit_index;     // Для каждой вершины - индекс среди выходов своей ячейки или NONE
+    };
+
+    // Способ, которым вершина была достигнута в ходе поиска
+    struct Parent
+    {
+        VertexId vertex;              // Предыдущая (для обратного поиска - следующая) вершина
+        EdgeId edge;                  // Исходное ребро графа (если level == 0)
+        size_t level = 0;             // Уровень клики, если вершина достигнута по ребру-клике
+    };
+
+    using QueueItem = std::pair<Weight, VertexId>;
+
+    // Очередь с минимумом наверху. Хранилище переиспользуется между поисками
+    struct Queue
+    {
+        std::vector<QueueItem> items;
+
+        bool empty() const
+        {
+            return items.empty();
+        }
+        const QueueItem& top() const
+        {
+            return items.front();
+        }
+        void push(QueueItem item)
+        {
+            items.push_back(item);
+            std::push_heap(items.begin(), items.end(), std::greater<QueueItem>());
+        }
+        void pop()
+        {
+            std::pop_heap(items.begin(), items.end(), std::greater<QueueItem>());
+            items.pop_back();
+        }
+    };
+
+    // Буферы поиска по вершинам графа. Заполнены только вершины из touched,
+    // Reset() возвращает буферы в исходное состояние за время, пропорциональное touched
+    struct SearchSide
+    {
+        std::vector<std::optional<Weight>> distances;
+        std::vector<std::optional<Parent>> parents;
+        std::vector<EdgeId> prev_edges;    // Для разворачивания клик: ребро, которым достигнута вершина
+        std::vector<VertexId> touched;
+        Queue queue;
+
+        void Resize(size_t vertex_count)
+        {
+            distances.assign(vertex_count, std::nullopt);
+            parents.assign(vertex_count, std::nullopt);
+            prev_edges.assign(vertex_count, 0);
+            touched.clear();
+            queue.items.clear();
+        }
+        void Reset()
+        {
+            for (const VertexId vertex : touched)
+            {
+                distances[vertex].reset();
+                parents[vertex].reset();
+            }
+            touched.clear();
+            queue.items.clear();
+        }
+        // Записывает расстояние вершины, запоминая ее для сброса
+        void SetDistance(VertexId vertex, Weight weight)
+        {
+            if (!distances[vertex])
+            {
+                touched.push_back(vertex);
+            }
+            distances[vertex] = weight;
+        }
+    };
+
+    uint32_t GetCell(size_t level, VertexId vertex) const
+    {
+        return partition_.cells[level][vertex];
+    }
+
+    // Ребро пересекает границу ячеек уровня level (индексация уровней с 0)
+    bool IsCutEdge(size_t level, const Edge<Weight>& edge) const
+    {
+        return GetCell(level, edge.from) != GetCell(level, edge.to);
+    }
+
+    // Уровень поиска вершины: наивысший уровень (1..L), на котором ячейка вершины не совпадает
+    // ни с ячейкой from, ни с ячейкой to. 0 - вершина лежит в нижней ячейке from или to
+    size_t GetQueryLevel(VertexId vertex, VertexId from, VertexId to) const
+    {
+        for (size_t level = partition_.GetLevelsCount(); level > 0; --level)
+        {
+            const uint32_t cell = GetCell(level - 1, vertex);
+            if (cell != GetCell(level - 1, from) && cell != GetCell(level - 1, to))
+            {
+                return level;
+            }
+        }
+        return 0;
+    }
+
+    void BuildBoundaries();
+    void CustomizeCell(size_t level, uint32_t cell_id);
+
+    // Поиск кратчайших расстояний внутри ячейки уровня level (level == 0 - по исходному графу).
+    // Заполняет расстояния посещенных вершин в буфере search (сбрасывает вызывающая сторона)
+    void LocalSearch(size_t level, uint32_t cell_id, VertexId source, SearchSide& search) const;
+
+    // Разворачивает ребро-клику уровня level в последовательность исходных ребер.
+    // Поиск не выходит за ячейку клики
+    void UnpackShortcut(size_t level, VertexId from, VertexId to, std::vector<EdgeId>& edges) const;
+
+    void Relax(SearchSide& side, const SearchSide& other, VertexId vertex, Weight weight,
+               Parent parent, std::optional<std::pair<Weight, VertexId>>& best) const;
+    void SettleForward(VertexId vertex, Weight weight, VertexId from, VertexId to,
+                       SearchSide& forward, const SearchSide& backward,
+                       std::optional<std::pair<Weight, VertexId>>& best) const;
+    void SettleBackward(VertexId vertex, Weight weight, VertexId from, VertexId to,
+                        SearchSide& backward, const SearchSide& forward,
+                        std::optional<std::pair<Weight, VertexId>>& best) const;
+
+    const Graph& graph_;
+    Partition partition_;
+    std::vector<std::vector<EdgeId>> reverse_incidence_lists_;    // Входящие ребра вершин (для обратного поиска)
+    std::vector<Level> levels_;
+
+    // Буферы запросов и кастомизации (размер - число вершин графа)
+    mutable SearchSide forward_;
+    mutable SearchSide backward_;
+    mutable SearchSide local_;
+    mutable std::vector<std::pair<VertexId, Parent>> forward_chain_;
+};
+
+template <typename Weight>
+CrpRouter<Weight>::CrpRouter(const Graph& graph, Partition partition)
+    : graph_(graph)
+    , partition_(std::move(partition))
+{
+    for (const auto& level_cells : partition_.cells)
+    {
+        if (level_cells.size() != graph_.GetVertexCount())
+        {
+            throw std::invalid_argument("Partition doesn't match graph vertex count");
+        }
+    }
+    Customize();
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::Customize()
+{
+    // Граничные вершины зависят только от разбиения и топологии графа,
+    // но граф мог быть перестроен вместе с новой метрикой - пересчитываем и их
+    BuildBoundaries();
+    for (size_t level = 0; level < levels_.size(); ++level)
+    {
+        for (uint32_t cell_id = 0; cell_id < levels_[level].cells.size(); ++cell_id)
+        {
+            CustomizeCell(level, cell_id);
+        }
+    }
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::BuildBoundaries()
+{
+    const size_t vertex_count = graph_.GetVertexCount();
+
+    forward_.Resize(vertex_count);
+    backward_.Resize(vertex_count);
+    local_.Resize(vertex_count);
+
+    reverse_incidence_lists_.assign(vertex_count, {});
+    for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+    {
+        const auto& edge = graph_.GetEdge(edge_id);
+        if (edge.weight < ZERO_WEIGHT)
+        {
+            throw std::domain_error("Edges' weights should be non-negative");
+        }
+        reverse_incidence_lists_[edge.to].push_back(edge_id);
+    }
+
+    levels_.assign(partition_.GetLevelsCount(), {});
+    for (size_t level = 0; level < levels_.size(); ++level)
+    {
+        Level& current = levels_[level];
+        uint32_t cells_count = 0;
+        for (const uint32_t cell : partition_.cells[level])
+        {
+            cells_count = std::max(cells_count, cell + 1);
+        }
+        current.cells.assign(cells_count, {});
+        current.entry_index.assign(vertex_count, NONE);
+        current.exit_index.assign(vertex_count, NONE);
+
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id)
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            if (!IsCutEdge(level, edge))
+            {
+                continue;
+            }
+            if (current.exit_index[edge.from] == NONE)
+            {
+                Cell& cell = current.cells[GetCell(level, edge.from)];
+                current.exit_index[edge.from] = static_cast<uint32_t>(cell.exits.size());
+                cell.exits.push_back(edge.from);
+            }
+            if (current.entry_index[edge.to] == NONE)
+            {
+                Cell& cell = current.cells[GetCell(level, edge.to)];
+                current.entry_index[edge.to] = static_cast<uint32_t>(cell.entries.size());
+                cell.entries.push_back(edge.to);
+            }
+        }
+    }
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::LocalSearch(size_t level, uint32_t cell_id, VertexId source, SearchSide& search) const
+{
+    // level - уровень ячейки, внутри которой идет поиск (индексация с 0).
+    // На нижнем уровне поиск идет по исходным ребрам, на верхних - по кликам
+    // подъячеек уровня level - 1 и ребрам между ними
+    auto& distances = search.distances;
+    auto& queue = search.queue;
+    search.SetDistance(source, ZERO_WEIGHT);
+    queue.push({ ZERO_WEIGHT, source });
+
+    auto relax = [&](VertexId vertex, Weight weight)
+    {
+        const auto& distance = distances[vertex];
+        if (!distance || weight < *distance)
+        {
+            search.SetDistance(vertex, weight);
+            queue.push({ weight, vertex });
+        }
+    };
+
+    while (!queue.empty())
+    {
+        const auto [weight, vertex] = queue.top();
+        queue.pop();
+        if (*distances[vertex] < weight)
+        {
+            continue;
+        }
+
+        if (level == 0)
+        {
+            for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+            {
+                const auto& edge = graph_.GetEdge(edge_id);
+                if (GetCell(0, edge.to) == cell_id)
+                {
+                    relax(edge.to, weight + edge.weight);
+                }
+            }
+            continue;
+        }
+
+        const size_t sublevel = level - 1;
+        const Level& sub = levels_[sublevel];
+        const Cell& subcell = sub.cells[GetCell(sublevel, vertex)];
+        if (const uint32_t entry = sub.entry_index[vertex]; entry != NONE)
+        {
+            for (size_t exit = 0; exit < subcell.exits.size(); ++exit)
+            {
+                if (const auto& shortcut = subcell.GetShortcut(entry, exit))
+                {
+                    relax(subcell.exits[exit], weight + *shortcut);
+                }
+            }
+        }
+        if (sub.exit_index[vertex] != NONE)
+        {
+            for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+            {
+                const auto& edge = graph_.GetEdge(edge_id);
+                if (IsCutEdge(sublevel, edge) && GetCell(level, edge.to) == cell_id)
+                {
+                    relax(edge.to, weight + edge.weight);
+                }
+            }
+        }
+    }
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::CustomizeCell(size_t level, uint32_t cell_id)
+{
+    Cell& cell = levels_[level].cells[cell_id];
+    cell.clique.assign(cell.entries.size() * cell.exits.size(), std::nullopt);
+
+    for (size_t entry = 0; entry < cell.entries.size(); ++entry)
+    {
+        LocalSearch(level, cell_id, cell.entries[entry], local_);
+        for (size_t exit = 0; exit < cell.exits.size(); ++exit)
+        {
+            cell.clique[entry * cell.exits.size() + exit] = local_.distances[cell.exits[exit]];
+        }
+        local_.Reset();
+    }
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::UnpackShortcut(size_t level, VertexId from, VertexId to, std::vector<EdgeId>& edges) const
+{
+    // Клика хранит только вес. Путь восстанавливаем локальным поиском по исходным
+    // ребрам внутри ячейки: кратчайший путь в ячейке имеет тот же вес, что и клика
+    const uint32_t cell_id = GetCell(level, from);
+    auto& distances = local_.distances;
+    auto& prev_edges = local_.prev_edges;
+    auto& queue = local_.queue;
+    local_.Reset();
+    local_.SetDistance(from, ZERO_WEIGHT);
+    queue.push({ ZERO_WEIGHT, from });
+
+    while (!queue.empty())
+    {
+        const auto [weight, vertex] = queue.top();
+        queue.pop();
+        if (vertex == to)
+        {
+            break;
+        }
+        if (*distances[vertex] < weight)
+        {
+            continue;
+        }
+        for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            if (GetCell(level, edge.to) != cell_id)
+            {
+                continue;
+            }
+            const Weight candidate = weight + edge.weight;
+            if (!distances[edge.to] || candidate < *distances[edge.to])
+            {
+                local_.SetDistance(edge.to, candidate);
+                prev_edges[edge.to] = edge_id;
+                queue.push({ candidate, edge.to });
+            }
+        }
+    }
+
+    const size_t first = edges.size();
+    for (VertexId vertex = to; vertex != from; vertex = graph_.GetEdge(prev_edges[vertex]).from)
+    {
+        edges.push_back(prev_edges[vertex]);
+    }
+    std::reverse(edges.begin() + first, edges.end());
+    local_.Reset();
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::Relax(SearchSide& side, const SearchSide& other, VertexId vertex, Weight weight,
+                              Parent parent, std::optional<std::pair<Weight, VertexId>>& best) const
+{
+    const auto& distance = side.distances[vertex];
+    if (distance && !(weight < *distance))
+    {
+        return;
+    }
+    side.SetDistance(vertex, weight);
+    side.parents[vertex] = parent;
+    side.queue.push({ weight, vertex });
+
+    // Вершина уже достигнута встречным поиском - обновляем лучший найденный путь
+    if (const auto& other_distance = other.distances[vertex])
+    {
+        const Weight total = weight + *other_distance;
+        if (!best || total < best->first)
+        {
+            best = std::make_pair(total, vertex);
+        }
+    }
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::SettleForward(VertexId vertex, Weight weight, VertexId from, VertexId to,
+                                      SearchSide& forward, const SearchSide& backward,
+                                      std::optional<std::pair<Weight, VertexId>>& best) const
+{
+    const size_t query_level = GetQueryLevel(vertex, from, to);
+    if (query_level == 0)
+    {
+        for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            Relax(forward, backward, edge.to, weight + edge.weight, { vertex, edge_id, 0 }, best);
+        }
+        return;
+    }
+
+    const size_t level = query_level - 1;
+    const Level& current = levels_[level];
+    const Cell& cell = current.cells[GetCell(level, vertex)];
+    if (const uint32_t entry = current.entry_index[vertex]; entry != NONE)
+    {
+        for (size_t exit = 0; exit < cell.exits.size(); ++exit)
+        {
+            if (const auto& shortcut = cell.GetShortcut(entry, exit))
+            {
+                Relax(forward, backward, cell.exits[exit], weight + *shortcut, { vertex, 0, query_level }, best);
+            }
+        }
+    }
+    if (current.exit_index[vertex] != NONE)
+    {
+        for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex))
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            if (IsCutEdge(level, edge))
+            {
+                Relax(forward, backward, edge.to, weight + edge.weight, { vertex, edge_id, 0 }, best);
+            }
+        }
+    }
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::SettleBackward(VertexId vertex, Weight weight, VertexId from, VertexId to,
+                                       SearchSide& backward, const SearchSide& forward,
+                                       std::optional<std::pair<Weight, VertexId>>& best) const
+{
+    const size_t query_level = GetQueryLevel(vertex, from, to);
+    if (query_level == 0)
+    {
+        for (const EdgeId edge_id : reverse_incidence_lists_[vertex])
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            Relax(backward, forward, edge.from, weight + edge.weight, { vertex, edge_id, 0 }, best);
+        }
+        return;
+    }
+
+    const size_t level = query_level - 1;
+    const Level& current = levels_[level];
+    const Cell& cell = current.cells[GetCell(level, vertex)];
+    if (const uint32_t exit = current.exit_index[vertex]; exit != NONE)
+    {
+        for (size_t entry = 0; entry < cell.entries.size(); ++entry)
+        {
+            if (const auto& shortcut = cell.GetShortcut(entry, exit))
+            {
+                Relax(backward, forward, cell.entries[entry], weight + *shortcut, { vertex, 0, query_level }, best);
+            }
+        }
+    }
+    if (current.entry_index[vertex] != NONE)
+    {
+        for (const EdgeId edge_id : reverse_incidence_lists_[vertex])
+        {
+            const auto& edge = graph_.GetEdge(edge_id);
+            if (IsCutEdge(level, edge))
+            {
+                Relax(backward, forward, edge.from, weight + edge.weight, { vertex, edge_id, 0 }, best);
+            }
+        }
+    }
+}
+
+template <typename Weight>
+std::optional<typename CrpRouter<Weight>::RouteInfo> CrpRouter<Weight>::BuildRoute(VertexId from,
+                                                                                   VertexId to) const
+{
+    std::vector<EdgeId> edges;
+    const auto weight = BuildRoute(from, to, edges);
+    if (!weight)
+    {
+        return std::nullopt;
+    }
+    return RouteInfo{ *weight, std::move(edges) };
+}
+
+template <typename Weight>
+std::optional<Weight> CrpRouter<Weight>::BuildRoute(VertexId from, VertexId to, std::vector<EdgeId>& edges) const
+{
+    edges.clear();
+    if (from == to)
+    {
+        return ZERO_WEIGHT;
+    }
+
+    // Буферы могли остаться заполненными после прерванного исключением запроса
+    SearchSide& forward = forward_;
+    SearchSide& backward = backward_;
+    forward.Reset();
+    backward.Reset();
+    std::optional<std::pair<Weight, VertexId>> best;    // Вес лучшего пути и вершина встречи
+
+    forward.SetDistance(from, ZERO_WEIGHT);
+    forward.queue.push({ ZERO_WEIGHT, from });
+    backward.SetDistance(to, ZERO_WEIGHT);
+    backward.queue.push({ ZERO_WEIGHT, to });
+
+    while (!forward.queue.empty() || !backward.queue.empty())
+    {
+        // Критерий остановки: сумма минимумов обеих очередей не меньше лучшего пути
+        if (best)
+        {
+            const Weight forward_min = forward.queue.empty() ? best->first : forward.queue.top().first;
+            const Weight backward_min = backward.queue.empty() ? best->first : backward.queue.top().first;
+            if (!(forward_min + backward_min < best->first))
+            {
+                break;
+            }
+        }
+
+        // Продвигаем направление с меньшим минимумом в очереди
+        const bool step_forward = backward.queue.empty()
+            || (!forward.queue.empty() && !(backward.queue.top().first < forward.queue.top().first));
+        SearchSide& side = step_forward ? forward : backward;
+        const auto [weight, vertex] = side.queue.top();
+        side.queue.pop();
+        if (*side.distances[vertex] < weight)
+        {
+            continue;
+        }
+        if (step_forward)
+        {
+            SettleForward(vertex, weight, from, to, forward, backward, best);
+        }
+        else
+        {
+            SettleBackward(vertex, weight, from, to, backward, forward, best);
+        }
+    }
+
+    if (!best)
+    {
+        return std::nullopt;
+    }
+
+    // Восстанавливаем путь: from -> вершина встречи по прямому поиску,
+    // затем вершина встречи -> to по обратному, разворачивая ребра-клики
+    const VertexId middle = best->second;
+    forward_chain_.clear();
+    for (VertexId vertex = middle; vertex != from; vertex = forward.parents[vertex]->vertex)
+    {
+        forward_chain_.emplace_back(vertex, *forward.parents[vertex]);
+    }
+
+    for (auto it = forward_chain_.rbegin(); it != forward_chain_.rend(); ++it)
+    {
+        const auto& [vertex, parent] = *it;
+        if (parent.level == 0)
+        {
+            edges.push_back(parent.edge);
+        }
+        else
+        {
+            UnpackShortcut(parent.level - 1, parent.vertex, vertex, edges);
+        }
+    }
+    for (VertexId vertex = middle; vertex != to; vertex = backward.parents[vertex]->vertex)
+    {
+        const Parent& parent = *backward.parents[vertex];
+        if (parent.level == 0)
+        {
+            edges.push_back(parent.edge);
+        }
+        else
+        {
+            UnpackShortcut(parent.level - 1, vertex, parent.vertex, edges);
+        }
+    }
+
+    return best->first;
+}
+
+template <typename Weight>
+void CrpRouter<Weight>::ReportMemory(memory_report::MemoryReport& report) const
+{
+    using namespace memory_report;
+    report.Add("CrpRouter", "partition", NestedVectorBytes(partition_.cells));
+    report.Add("CrpRouter", "reverse_incidence_lists", NestedVectorBytes(reverse_incidence_lists_));
+    size_t boundary_bytes = VectorBytes(levels_);
+    size_t clique_bytes = 0;
+    for (const Level& level : levels_)
+    {
+        boundary_bytes += VectorBytes(level.cells) + VectorBytes(level.entry_index) + VectorBytes(level.exit_index);
+        for (const Cell& cell : level.cells)
+        {
+            boundary_bytes += VectorBytes(cell.entries) + VectorBytes(cell.exits);
+            clique_bytes += VectorBytes(cell.clique);
+        }
+    }
+    report.Add("CrpRouter", "boundary_vertices", boundary_bytes);
+    report.Add("CrpRouter", "cliques", clique_bytes);
+    size_t buffers_bytes = VectorBytes(forward_chain_);
+    for (const SearchSide* side : { &forward_, &backward_, &local_ })
+    {
+        buffers_bytes += VectorBytes(side->distances) + VectorBytes(side->parents) + VectorBytes(side->prev_edges)
+            + VectorBytes(side->touched) + VectorBytes(side->queue.items);
+    }
+    report.Add("CrpRouter", "query_buffers", buffers_bytes);
+}
+
+}  // namespace graph
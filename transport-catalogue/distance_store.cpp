@@ -0,0 +1,158 @@
+#include "distance_store.h"
+#include "memory_report.h"
+
+#include <algorithm>    // для std::minmax
+#include <utility>
+
+namespace transport_catalogue
+{
+
+// ----------- DistanceStore ---------------
+
+uint64_t DistanceStore::MakeKey(StopId from, StopId to)
+{
+	const auto [lo, hi] = std::minmax(from, to);
+	return (static_cast<uint64_t>(lo) << 32) | hi;
+}
+
+
+size_t DistanceStore::FindSlot(uint64_t key) const
+{
+	// Мультипликативное (фибоначчиево) хэширование: старшие биты произведения
+	// хорошо перемешаны даже для близких номеров остановок
+	const size_t mask = entries_.size() - 1;
+	size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+	while (entries_[slot].key != key && entries_[slot].key != EMPTY_KEY)
+	{
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+
+void DistanceStore::Grow()
+{
+	Rehash(entries_.empty() ? 16 : entries_.size() * 2);
+}
+
+
+void DistanceStore::Rehash(size_t new_size)
+{
+	std::vector<Entry> old_entries = std::move(entries_);
+	entries_.assign(new_size, Entry{});
+	for (const Entry& entry : old_entries)
+	{
+		if (entry.key != EMPTY_KEY)
+		{
+			entries_[FindSlot(entry.key)] = entry;
+		}
+	}
+}
+
+
+uint32_t& DistanceStore::GetValueSlot(StopId from, StopId to)
+{
+	// Заполненность таблицы не больше 1/2 - цепочки проб остаются короткими
+	if ((used_entries_ + 1) * 2 > entries_.size())
+	{
+		Grow();
+	}
+
+	const uint64_t key = MakeKey(from, to);
+	Entry& entry = entries_[FindSlot(key)];
+	if (entry.key == EMPTY_KEY)
+	{
+		entry.key = key;
+		++used_entries_;
+	}
+	return (from <= to) ? entry.lo_to_hi : entry.hi_to_lo;
+}
+
+
+void DistanceStore::Add(StopId from, StopId to, size_t distance)
+{
+	uint32_t& value = GetValueSlot(from, to);
+	if (value == NO_DISTANCE)
+	{
+		value = static_cast<uint32_t>(distance);
+		++distances_count_;
+	}
+}
+
+
+void DistanceStore::Set(StopId from, StopId to, size_t distance)
+{
+	uint32_t& value = GetValueSlot(from, to);
+	if (value == NO_DISTANCE)
+	{
+		++distances_count_;
+	}
+	value = static_cast<uint32_t>(distance);
+}
+
+
+void DistanceStore::Reserve(size_t distances_count)
+{
+	// В худшем случае каждое расстояние занимает отдельную запись
+	size_t new_size = entries_.empty() ? 16 : entries_.size();
+	while ((used_entries_ + distances_count) * 2 > new_size)
+	{
+		new_size *= 2;
+	}
+	if (new_size != entries_.size())
+	{
+		Rehash(new_size);
+	}
+}
+
+
+size_t DistanceStore::Get(StopId from, StopId to) const
+{
+	if (entries_.empty())
+	{
+		return 0U;
+	}
+	const Entry& entry = entries_[FindSlot(MakeKey(from, to))];
+	if (entry.key == EMPTY_KEY)
+	{
+		return 0U;
+	}
+	const uint32_t direct = (from <= to) ? entry.lo_to_hi : entry.hi_to_lo;
+	const uint32_t reverse = (from <= to) ? entry.hi_to_lo : entry.lo_to_hi;
+	// Если прямого расстояния нет (или оно 0), возвращаем обратное расстояние, даже если оно 0
+	if (direct != NO_DISTANCE && direct > 0)
+	{
+		return direct;
+	}
+	return (reverse != NO_DISTANCE) ? reverse : 0U;
+}
+
+
+size_t DistanceStore::GetDirectly(StopId from, StopId to) const
+{
+	if (entries_.empty())
+	{
+		return 0U;
+	}
+	const Entry& entry = entries_[FindSlot(MakeKey(from, to))];
+	if (entry.key == EMPTY_KEY)
+	{
+		return 0U;
+	}
+	const uint32_t direct = (from <= to) ? entry.lo_to_hi : entry.hi_to_lo;
+	return (direct != NO_DISTANCE) ? direct : 0U;
+}
+
+
+size_t DistanceStore::Size() const
+{
+	return distances_count_;
+}
+
+
+size_t DistanceStore::GetMemoryUsage() const
+{
+	return memory_report::VectorBytes(entries_);
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Назначение модуля: хранилище расстояний по дорогам между остановками.
+ *
+ * Таблица с открытой адресацией (линейное пробирование) в одном плоском векторе.
+ * Ключ - упакованная в 64 бита неупорядоченная пара номеров остановок (меньший номер
+ * в старших битах), в записи хранятся оба направления. Поэтому поиск расстояния
+ * с откатом на обратное направление выполняется за одну последовательность проб.
+ */
+
+#pragma once
+
+#include "domain.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace transport_catalogue
+{
+
+// ----------- DistanceStore ---------------
+
+class DistanceStore
+{
+public:
+	// Добавляет расстояние from -> to. Уже заданное расстояние не перезаписывается
+	void Add(StopId from, StopId to, size_t distance);
+	// Задает расстояние from -> to, перезаписывая уже заданное
+	void Set(StopId from, StopId to, size_t distance);
+	// Готовит таблицу к добавлению distances_count расстояний без промежуточных перестроений
+	void Reserve(size_t distances_count);
+
+	// Возвращает расстояние from -> to, если оно задано, иначе обратное расстояние to -> from (или 0)
+	size_t Get(StopId from, StopId to) const;
+	// Возвращает расстояние from -> to без перестановки пары (0, если не задано)
+	size_t GetDirectly(StopId from, StopId to) const;
+
+	// Количество заданных расстояний (каждое направление считается отдельно)
+	size_t Size() const;
+	// Динамическая память таблицы, байт
+	size_t GetMemoryUsage() const;
+
+	// Вызывает callback(from, to, distance) для каждого заданного расстояния
+	template <typename Callback>
+	void ForEach(Callback&& callback) const;
+
+private:
+	static constexpr uint64_t EMPTY_KEY = UINT64_MAX;     // Ключ свободной ячейки
+	static constexpr uint32_t NO_DISTANCE = UINT32_MAX;   // Расстояние в этом направлении не задано
+
+	// Запись таблицы: пара остановок lo < hi (или lo == hi) и расстояния в обе стороны
+	struct Entry
+	{
+		uint64_t key = EMPTY_KEY;
+		uint32_t lo_to_hi = NO_DISTANCE;
+		uint32_t hi_to_lo = NO_DISTANCE;
+	};
+
+	static uint64_t MakeKey(StopId from, StopId to);
+	// Возвращает ячейку расстояния from -> to, при необходимости заводя запись пары
+	uint32_t& GetValueSlot(StopId from, StopId to);
+	// Индекс ячейки с ключом key или свободной ячейки, где он должен находиться
+	size_t FindSlot(uint64_t key) const;
+	// Увеличивает таблицу вдвое, перераспределяя записи
+	void Grow();
+	// Перераспределяет записи в таблицу размера new_size (степень двойки)
+	void Rehash(size_t new_size);
+
+	std::vector<Entry> entries_;     // Размер - степень двойки (или 0)
+	size_t used_entries_ = 0;        // Количество занятых ячеек
+	size_t distances_count_ = 0;     // Количество заданных расстояний
+};
+
+template <typename Callback>
+void DistanceStore::ForEach(Callback&& callback) const
+{
+	for (const Entry& entry : entries_)
+	{
+		if (entry.key == EMPTY_KEY)
+		{
+			continue;
+		}
+		const StopId lo = static_cast<StopId>(entry.key >> 32);
+		const StopId hi = static_cast<StopId>(entry.key);
+		if (entry.lo_to_hi != NO_DISTANCE)
+		{
+			callback(lo, hi, static_cast<size_t>(entry.lo_to_hi));
+		}
+		if (entry.hi_to_lo != NO_DISTANCE && lo != hi)
+		{
+			callback(hi, lo, static_cast<size_t>(entry.hi_to_lo));
+		}
+	}
+}
+
+}
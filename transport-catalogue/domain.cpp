@@ -13,12 +13,14 @@ namespace transport_catalogue
 
 Stop::Stop(StopPtr other_stop_ptr) :
 	name(other_stop_ptr->name),
-	coords(other_stop_ptr->coords)
+	coords(other_stop_ptr->coords),
+	id(other_stop_ptr->id),
+	is_boundary(other_stop_ptr->is_boundary)
 {}
 
-Stop::Stop(const std::string_view stop_name, const double lat, const double lng) : 
-	name(stop_name), 
-	coords(geo::Coordinates{ lat, lng })
+Stop::Stop(InternedString stop_name, geo::Coordinates stop_coords) :
+	name(stop_name),
+	coords(stop_coords)
 {}
 
 // ---------------- struct Route ----------------------
@@ -26,24 +28,17 @@ Stop::Stop(const std::string_view stop_name, const double lat, const double lng)
 Route::Route(RoutePtr other_stop_ptr) :
     route_name(other_stop_ptr->route_name),
 	stops(other_stop_ptr->stops),
+	id(other_stop_ptr->id),
 	unique_stops_qty(other_stop_ptr->unique_stops_qty),
 	geo_route_length(other_stop_ptr->geo_route_length),
 	meters_route_length(other_stop_ptr->meters_route_length),
 	curvature(other_stop_ptr->curvature),
-	is_circular(other_stop_ptr->is_circular)
+	is_circular(other_stop_ptr->is_circular),
+	region(other_stop_ptr->region)
 {}
 
-// ----------- class PairPointersHasher --------------
-
-std::size_t  PairPointersHasher::operator()(const std::pair<StopPtr, StopPtr> pair_of_pointers) const noexcept
-{
-	//auto ptr1 = static_cast<const void*>(pair_of_pointers.first);
-	//auto ptr2 = static_cast<const void*>(pair_of_pointers.second);
-	//return hasher_(ptr1) * 37 + hasher_(ptr2);
-
-	return hasher_(static_cast<const void*>(pair_of_pointers.first)) * 37
-		+ hasher_(static_cast<const void*>(pair_of_pointers.second));
-
-}
+Route::Route(std::pmr::vector<StopId> route_stops) :
+	stops(std::move(route_stops))
+{}
 
 } // namespace transport_catalogue
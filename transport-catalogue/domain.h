@@ -10,11 +10,16 @@
 #pragma once
 
 #include "geo.h"
+#include "ranges.h"
+#include "string_arena.h"   // дескрипторы названий, размещенных в арене каталога
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 #include <vector>
 #include <functional>      // Для шаблона hash<>
+#include <memory_resource>  // Для остановок маршрута в памяти каталога
+#include <iterator>        // Для категории итератора обхода маршрута
 
 namespace transport_catalogue
 {
@@ -27,19 +32,111 @@ using StopPtr = const Stop*;
 // Тип: константный указатель на запись о маршруте в БД маршрутов
 using RoutePtr = const Route*;
 
+// Тип: плотный номер остановки в БД остановок (назначается каталогом в порядке добавления: 0, 1, 2...)
+using StopId = uint32_t;
+// Тип: плотный номер маршрута в БД маршрутов (назначается каталогом в порядке добавления)
+using RouteId = uint32_t;
+// Тип: номер региона (назначается каталогом в порядке первого упоминания; 0 - регион по умолчанию без названия)
+using RegionId = uint32_t;
+
 // Структура, хранящая информацию об остановке и определяющая
 // методы работы с ней
 struct Stop
 {
 	// Включаем конструктор по-умолчанию из-за наличия параметризованного конструктора
 	Stop() = default;
-	// Конструктор по имени и двум координатам
-	Stop(const std::string_view stop_name, const double lat, const double lng);
+	// Конструктор по названию (размещенному в арене) и координатам
+	Stop(InternedString stop_name, geo::Coordinates stop_coords);
 	// Конструктор копирования на основе константного указателя (для возврата данных обработчикам)
 	Stop(StopPtr other_stop_ptr);
 
-	std::string name;                   // Название остановки
+	InternedString name;                // Название остановки (в арене каталога)
 	geo::Coordinates coords{ 0L,0L };   // Координаты
+	StopId id = 0;                      // Номер остановки (заполняется каталогом)
+	bool is_boundary = false;           // Пограничная остановка: пересадка между маршрутами разных регионов
+};
+
+// Остановки маршрута в порядке движения автобуса. Маршрут хранится так, как он задан;
+// некольцевой маршрут проходится туда и обратно: остановки 0..n-1, затем n-2..0.
+// Обратное направление не хранится, а получается отражением номера позиции
+class RouteTraversal
+{
+public:
+	class Iterator
+	{
+	public:
+		// Разыменование возвращает номер по значению (обратное направление не хранится),
+		// поэтому итератор - входной: ссылку на элемент он дать не может
+		using iterator_category = std::input_iterator_tag;
+		using value_type = StopId;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = StopId;
+
+		Iterator() = default;
+		Iterator(const RouteTraversal* traversal, size_t pos) : traversal_(traversal), pos_(pos)
+		{}
+		StopId operator*() const
+		{
+			return (*traversal_)[pos_];
+		}
+		Iterator& operator++()
+		{
+			++pos_;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator old = *this;
+			++pos_;
+			return old;
+		}
+		bool operator==(const Iterator& other) const
+		{
+			return pos_ == other.pos_;
+		}
+		bool operator!=(const Iterator& other) const
+		{
+			return pos_ != other.pos_;
+		}
+
+	private:
+		const RouteTraversal* traversal_ = nullptr;
+		size_t pos_ = 0;
+	};
+
+	RouteTraversal() = default;
+	// stops - count остановок маршрута в том виде, как он задан
+	RouteTraversal(const StopId* stops, size_t count, bool is_circular)
+		: stops_(stops), count_(count), is_circular_(is_circular)
+	{}
+
+	// Количество остановок при обходе (для некольцевого маршрута из n остановок - 2n - 1)
+	size_t size() const
+	{
+		return (is_circular_ || count_ == 0) ? count_ : count_ * 2 - 1;
+	}
+	bool empty() const
+	{
+		return count_ == 0;
+	}
+	StopId operator[](size_t pos) const
+	{
+		return (pos < count_) ? stops_[pos] : stops_[count_ * 2 - 2 - pos];
+	}
+	Iterator begin() const
+	{
+		return Iterator(this, 0);
+	}
+	Iterator end() const
+	{
+		return Iterator(this, size());
+	}
+
+private:
+	const StopId* stops_ = nullptr;
+	size_t count_ = 0;
+	bool is_circular_ = false;
 };
 
 // Структура, хранящая информацию о маршруте и определяющая
@@ -50,36 +147,41 @@ struct Route
 	Route() = default;
     // Конструктор копирования на основе константного указателя (для возврата данных обработчикам)
 	Route(RoutePtr other_stop_ptr);
+	// Конструктор по остановкам: вектор сохраняет источник памяти, из которого он выделен
+	explicit Route(std::pmr::vector<StopId> route_stops);
+
+	// Остановки в порядке движения (для некольцевого - туда и обратно)
+	RouteTraversal Traversal() const
+	{
+		return RouteTraversal(stops.data(), stops.size(), is_circular);
+	}
 
-	std::string route_name;            // Номер маршрута (название)
-	std::vector<StopPtr> stops;        // Контейнер указателей на остановки маршрута
+	InternedString route_name;         // Номер маршрута (название, в арене каталога)
+	std::pmr::vector<StopId> stops;    // Номера остановок маршрута так, как он задан (без обратного направления)
+	RouteId id = 0;                    // Номер маршрута (заполняется каталогом)
 	size_t unique_stops_qty = 0U;      // Количество уникальных остановок на маршруте (кэшируем, т.к. изменяется только при перестроении маршрута)
 	double geo_route_length = 0L;      // Длина маршрута по прямой между координатами (кэшируем, т.к. изменяется только при перестроении маршрута)
 	size_t meters_route_length = 0U;   // Длина маршрута с учетом заданных расстояний между точками (метры) (кэшируем, т.к. изменяется только при перестроении маршрута)
 	double curvature = 0L;             // Извилистость маршрута = meters_route_length / geo_route_length. >1 для любого маршрута, кроме подземного
 	bool is_circular = false;          // Является ли маршрут кольцевым
+	RegionId region = 0;               // Регион, которому принадлежит маршрут
 };
 
-// Структура для передачи координат в рендерер карт
-struct RendererData
+// Маршрут для рендерера карт. Не владеет данными: ссылается на хранилище каталога
+struct RendererRoute
 {
-	std::vector<geo::Coordinates> stop_coords;    // Контейнер координат остановок
-	std::vector<std::string_view> stop_names;     // Контейнер указателей на названия остановок
-	bool is_circular = false;                     // Является ли маршрут кольцевым
+	std::string_view name;             // Номер маршрута
+	RouteTraversal stops;              // Номера остановок в порядке движения
+	bool is_circular = false;          // Является ли маршрут кольцевым
 };
 
-// Класс хэшера для unordered_map с ключом типа pair<StopPtr, StopPtr>
-class PairPointersHasher
+// Данные карты для рендерера карт. Все диапазоны ссылаются на хранилище каталога и живут вместе с ним
+struct RendererData
 {
-public:
-	std::size_t operator()(const std::pair<StopPtr, StopPtr> pair_of_pointers) const noexcept;
-
-private:
-	// Хэш - функция для шаблонного варианта PairPointersHasher<T == Stop>
-	//std::hash<std::uintptr_t> hasher_;
-
-	// Стандартная хэш-функция для const void*
-	std::hash<const void*> hasher_;
+	ranges::Range<const RendererRoute*> routes;            // Непустые маршруты по алфавиту
+	ranges::Range<const std::string_view*> stop_names;     // Остановки этих маршрутов по алфавиту
+	ranges::Range<const geo::Coordinates*> stop_coords;    // Координаты тех же остановок в том же порядке
+	const geo::CoordinatesArray* coords_by_id = nullptr;   // Координаты всех остановок по номеру
 };
 
 } // namespace transport_catalogue
@@ -0,0 +1,663 @@
+#include "frozen_catalogue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+namespace transport_catalogue
+{
+
+namespace
+{
+
+// Количество блоков для count номеров
+size_t ChunksCount(size_t count, size_t chunk_bits)
+{
+	return (count + (size_t{ 1 } << chunk_bits) - 1) >> chunk_bits;
+}
+
+// Номера блоков (по возрастанию, без повторов), в которые попадают номера ids.
+// Блоки за пределами chunks_count пропускаются
+template <typename Id>
+std::vector<size_t> GetChunks(std::vector<Id> ids, size_t chunk_bits, size_t chunks_count)
+{
+	std::vector<size_t> chunks;
+	chunks.reserve(ids.size());
+	for (const Id id : ids)
+	{
+		const size_t chunk = static_cast<size_t>(id) >> chunk_bits;
+		if (chunk < chunks_count)
+		{
+			chunks.push_back(chunk);
+		}
+	}
+	std::sort(chunks.begin(), chunks.end());
+	chunks.erase(std::unique(chunks.begin(), chunks.end()), chunks.end());
+	return chunks;
+}
+
+} // namespace
+
+// ----------- FrozenCatalogue ---------------
+
+FrozenCatalogue::FrozenCatalogue(const TransportCatalogue& tc)
+	: names_(tc.GetNamesArena())
+	, stops_count_(tc.GetAllStopsCount())
+	, routes_count_(tc.GetAllRoutesCount())
+	, stops_coords_(std::make_shared<const geo::CoordinatesArray>(tc.GetStopsCoordinates()))
+	, stops_spatial_index_(std::make_shared<const geo::SpatialIndex>(*stops_coords_))
+	, distances_(std::make_shared<const DistanceStore>(tc.GetAllDistances()))
+{
+	// 1. Все блоки строятся из каталога
+	std::vector<StopId> all_stops(stops_count_);
+	std::iota(all_stops.begin(), all_stops.end(), StopId{ 0 });
+	stops_.resize(ChunksCount(stops_count_, CHUNK_BITS));
+	RebuildStopsChunks(tc, std::move(all_stops));
+	std::vector<RouteId> all_routes(routes_count_);
+	std::iota(all_routes.begin(), all_routes.end(), RouteId{ 0 });
+	routes_.resize(ChunksCount(routes_count_, CHUNK_BITS));
+	RebuildRoutesChunks(tc, std::move(all_routes));
+	for (RegionId id = 0; id < tc.GetRegionsCount(); ++id)
+	{
+		region_names_.push_back(tc.GetRegionName(id));
+	}
+
+	// 2. Номера маршрутов по алфавиту
+	auto routes_by_name = std::make_shared<std::vector<RouteId>>(routes_count_);
+	std::iota(routes_by_name->begin(), routes_by_name->end(), RouteId{ 0 });
+	std::sort(routes_by_name->begin(), routes_by_name->end(), [this](RouteId lhs, RouteId rhs)
+			  {
+				  return GetRouteName(lhs) < GetRouteName(rhs);
+			  });
+	routes_by_name_ = std::move(routes_by_name);
+
+	// 3. Индексы названий. Параметры функций замороженного каталога подходят и снимку
+	BuildNameIndexes(tc.IsFrozen() ? &tc : nullptr);
+}
+
+
+FrozenCatalogue::FrozenCatalogue(const TransportCatalogue& tc, const FrozenCatalogue& previous, CatalogueChanges changes)
+	: names_(tc.GetNamesArena())
+	, stops_count_(tc.GetAllStopsCount())
+	, routes_count_(tc.GetAllRoutesCount())
+	, stops_(previous.stops_)
+	, routes_(previous.routes_)
+	, region_names_(previous.region_names_)
+	, stops_coords_((changes.stops_added || changes.coordinates)
+					? std::make_shared<const geo::CoordinatesArray>(tc.GetStopsCoordinates())
+					: previous.stops_coords_)
+	, stops_spatial_index_((stops_coords_ == previous.stops_coords_)
+						   ? previous.stops_spatial_index_
+						   : std::make_shared<const geo::SpatialIndex>(*stops_coords_))
+	, distances_(changes.distances
+				 ? std::make_shared<const DistanceStore>(tc.GetAllDistances())
+				 : previous.distances_)
+	, routes_by_name_(previous.routes_by_name_)
+	, name_indexes_(previous.name_indexes_)
+	, added_stop_names_(previous.added_stop_names_)
+	, added_route_names_(previous.added_route_names_)
+	, stale_routes_(previous.stale_routes_)
+{
+	// 1. Из каталога перестраиваются только блоки затронутых остановок и маршрутов.
+	// Изменение числа номеров затрагивает последний блок: его номера есть в списках изменений
+	stops_.resize(ChunksCount(stops_count_, CHUNK_BITS));
+	RebuildStopsChunks(tc, std::move(changes.changed_stops));
+	std::vector<RouteId> changed_routes = std::move(changes.changed_routes);
+	std::sort(changed_routes.begin(), changed_routes.end());
+	changed_routes.erase(std::unique(changed_routes.begin(), changed_routes.end()), changed_routes.end());
+	routes_.resize(ChunksCount(routes_count_, CHUNK_BITS));
+	RebuildRoutesChunks(tc, changed_routes);
+	// Регионы только добавляются
+	for (RegionId id = static_cast<RegionId>(region_names_.size()); id < tc.GetRegionsCount(); ++id)
+	{
+		region_names_.push_back(tc.GetRegionName(id));
+	}
+
+	// 2. Номера, название маршрута на которых сменилось: маршрут добавлен, удален или
+	// перенесен на номер удаленного
+	std::vector<RouteId> renamed;
+	for (const RouteId id : changed_routes)
+	{
+		const bool had_route = id < previous.routes_count_;
+		const bool has_route = id < routes_count_;
+		if (had_route != has_route || (has_route && previous.GetRouteName(id) != GetRouteName(id)))
+		{
+			renamed.push_back(id);
+		}
+	}
+	if (!renamed.empty())
+	{
+		UpdateRoutesByName(previous, renamed);
+	}
+	UpdateNameIndexes(previous, renamed);
+
+	// 3. Карту меняют только маршруты и координаты остановок
+	if (!changes.routes && !changes.coordinates)
+	{
+		renderer_ = std::atomic_load(&previous.renderer_);
+	}
+}
+
+
+void FrozenCatalogue::RebuildStopsChunks(const TransportCatalogue& tc, std::vector<StopId> ids)
+{
+	for (const size_t chunk_index : GetChunks(std::move(ids), CHUNK_BITS, stops_.size()))
+	{
+		const StopId begin = static_cast<StopId>(chunk_index << CHUNK_BITS);
+		const StopId end = static_cast<StopId>(std::min(stops_count_, size_t{ begin } + CHUNK_SIZE));
+		auto chunk = std::make_shared<StopsChunk>();
+		chunk->names.reserve(end - begin);
+		chunk->is_boundary.reserve(end - begin);
+		chunk->buses_offsets.reserve(end - begin + 1);
+		chunk->buses_offsets.push_back(0U);
+		for (StopId id = begin; id < end; ++id)
+		{
+			const StopPtr stop = tc.GetStop(id);
+			chunk->names.push_back(stop->name);
+			chunk->is_boundary.push_back(stop->is_boundary ? 1 : 0);
+			// Маршруты остановки в каталоге уже отсортированы по названию
+			const BusesRange buses = tc.GetStopStat(id)->buses;
+			chunk->buses.insert(chunk->buses.end(), buses.begin(), buses.end());
+			chunk->buses_offsets.push_back(static_cast<uint32_t>(chunk->buses.size()));
+		}
+		// Ответы ссылаются на массив маршрутов блока - он уже заполнен целиком
+		chunk->stats.reserve(end - begin);
+		for (size_t i = 0; i < chunk->names.size(); ++i)
+		{
+			StopStat& stat = chunk->stats.emplace_back(chunk->names[i]);
+			stat.buses = BusesRange(chunk->buses.data() + chunk->buses_offsets[i],
+									chunk->buses.data() + chunk->buses_offsets[i + 1]);
+		}
+		stops_[chunk_index] = std::move(chunk);
+	}
+}
+
+
+void FrozenCatalogue::RebuildRoutesChunks(const TransportCatalogue& tc, std::vector<RouteId> ids)
+{
+	for (const size_t chunk_index : GetChunks(std::move(ids), CHUNK_BITS, routes_.size()))
+	{
+		const RouteId begin = static_cast<RouteId>(chunk_index << CHUNK_BITS);
+		const RouteId end = static_cast<RouteId>(std::min(routes_count_, size_t{ begin } + CHUNK_SIZE));
+		auto chunk = std::make_shared<RoutesChunk>();
+		chunk->names.reserve(end - begin);
+		chunk->stops_offsets.reserve(end - begin + 1);
+		chunk->stops_offsets.push_back(0U);
+		chunk->is_circular.reserve(end - begin);
+		chunk->regions.reserve(end - begin);
+		chunk->stats.reserve(end - begin);
+		for (RouteId id = begin; id < end; ++id)
+		{
+			const RoutePtr route = tc.GetRoute(id);
+			const std::string_view name = route->route_name;
+			chunk->names.push_back(name);
+			chunk->stops.insert(chunk->stops.end(), route->stops.begin(), route->stops.end());
+			chunk->stops_offsets.push_back(static_cast<uint32_t>(chunk->stops.size()));
+			chunk->is_circular.push_back(route->is_circular ? 1 : 0);
+			chunk->regions.push_back(route->region);
+			RouteStat& stat = chunk->stats.emplace_back(*tc.GetRouteStat(id));
+			stat.name = name;
+		}
+		routes_[chunk_index] = std::move(chunk);
+	}
+}
+
+
+void FrozenCatalogue::UpdateRoutesByName(const FrozenCatalogue& previous, const std::vector<RouteId>& renamed)
+{
+	// Порядок остальных маршрутов не меняется: убираем номера со сменившимся названием
+	// и вставляем их новые названия на свои места
+	auto routes_by_name = std::make_shared<std::vector<RouteId>>();
+	routes_by_name->reserve(routes_count_);
+	for (const RouteId id : *previous.routes_by_name_)
+	{
+		if (!std::binary_search(renamed.begin(), renamed.end(), id))
+		{
+			routes_by_name->push_back(id);
+		}
+	}
+	for (const RouteId id : renamed)
+	{
+		if (id >= routes_count_)
+		{
+			continue;
+		}
+		const auto it = std::lower_bound(routes_by_name->begin(), routes_by_name->end(), GetRouteName(id),
+										 [this](RouteId route, std::string_view name)
+										 {
+											 return GetRouteName(route) < name;
+										 });
+		routes_by_name->insert(it, id);
+	}
+	routes_by_name_ = std::move(routes_by_name);
+}
+
+
+void FrozenCatalogue::UpdateNameIndexes(const FrozenCatalogue& previous, const std::vector<RouteId>& renamed)
+{
+	// 1. Новые остановки получают номера после всех прежних
+	for (StopId id = static_cast<StopId>(previous.stops_count_); id < stops_count_; ++id)
+	{
+		added_stop_names_.emplace(GetStopName(id), id);
+	}
+	// 2. Прежние названия с номеров маршрутов убираются, затем добавляются новые: название
+	// могло перейти на другой номер
+	for (const RouteId id : renamed)
+	{
+		if (id >= previous.routes_count_)
+		{
+			continue;
+		}
+		if (const auto it = added_route_names_.find(previous.GetRouteName(id));
+			it != added_route_names_.end() && it->second == id)
+		{
+			added_route_names_.erase(it);
+		}
+		if (id < name_indexes_->routes_count)
+		{
+			const auto it = std::lower_bound(stale_routes_.begin(), stale_routes_.end(), id);
+			if (it == stale_routes_.end() || *it != id)
+			{
+				stale_routes_.insert(it, id);
+			}
+		}
+	}
+	for (const RouteId id : renamed)
+	{
+		if (id < routes_count_)
+		{
+			added_route_names_[GetRouteName(id)] = id;
+		}
+	}
+
+	// 3. Поиск по словарям и подсказки по ним - перебором, поэтому словари небольшие
+	if (added_stop_names_.size() + added_route_names_.size() + stale_routes_.size() > NAME_OVERLAY_LIMIT)
+	{
+		BuildNameIndexes(nullptr);
+	}
+}
+
+
+void FrozenCatalogue::BuildNameIndexes(const TransportCatalogue* frozen_tc)
+{
+	std::vector<std::string_view> stop_names;
+	stop_names.reserve(stops_count_);
+	for (StopId id = 0; id < stops_count_; ++id)
+	{
+		stop_names.push_back(GetStopName(id));
+	}
+	std::vector<std::string_view> route_names;
+	route_names.reserve(routes_count_);
+	for (RouteId id = 0; id < routes_count_; ++id)
+	{
+		route_names.push_back(GetRouteName(id));
+	}
+
+	auto indexes = std::make_shared<NameIndexes>();
+	if (frozen_tc)
+	{
+		indexes->stops = PerfectHashIndex(frozen_tc->GetStopsIndexData(), stop_names);
+		indexes->routes = PerfectHashIndex(frozen_tc->GetRoutesIndexData(), route_names);
+	}
+	else
+	{
+		indexes->stops = PerfectHashIndex(stop_names);
+		indexes->routes = PerfectHashIndex(route_names);
+	}
+	indexes->suggest = NameSuggestIndex(stop_names, route_names);
+	indexes->routes_count = routes_count_;
+	name_indexes_ = std::move(indexes);
+	added_stop_names_.clear();
+	added_route_names_.clear();
+	stale_routes_.clear();
+}
+
+
+std::shared_ptr<const FrozenCatalogue::RendererStore> FrozenCatalogue::BuildRendererStore() const
+{
+	auto store = std::make_shared<RendererStore>();
+	store->routes_chunks = routes_;
+
+	// Остановки, через которые не идет ни один маршрут, на карту не попадают
+	for (const RouteId route : *routes_by_name_)
+	{
+		const RouteTraversal stops = GetRouteStops(route);
+		if (!stops.empty())
+		{
+			store->routes.push_back({ GetRouteName(route), stops, IsRouteCircular(route) });
+		}
+	}
+	std::vector<StopId> map_stops;
+	for (StopId id = 0; id < stops_count_; ++id)
+	{
+		if (!GetStopStat(id)->buses.empty())
+		{
+			map_stops.push_back(id);
+		}
+	}
+	std::sort(map_stops.begin(), map_stops.end(), [this](StopId lhs, StopId rhs)
+			  {
+				  return GetStopName(lhs) < GetStopName(rhs);
+			  });
+	store->stop_names.reserve(map_stops.size());
+	store->stop_coords.reserve(map_stops.size());
+	for (const StopId id : map_stops)
+	{
+		store->stop_names.push_back(GetStopName(id));
+		store->stop_coords.push_back(GetStopCoordinates(id));
+	}
+	return store;
+}
+
+
+size_t FrozenCatalogue::GetStopsCount() const
+{
+	return stops_count_;
+}
+
+
+size_t FrozenCatalogue::GetRoutesCount() const
+{
+	return routes_count_;
+}
+
+
+std::string_view FrozenCatalogue::GetStopName(StopId stop_id) const
+{
+	return stops_[stop_id >> CHUNK_BITS]->names[stop_id & CHUNK_MASK];
+}
+
+
+geo::Coordinates FrozenCatalogue::GetStopCoordinates(StopId stop_id) const
+{
+	return stops_coords_->Get(stop_id);
+}
+
+
+const geo::CoordinatesArray& FrozenCatalogue::GetStopsCoordinates() const
+{
+	return *stops_coords_;
+}
+
+
+std::string_view FrozenCatalogue::GetRouteName(RouteId route_id) const
+{
+	return routes_[route_id >> CHUNK_BITS]->names[route_id & CHUNK_MASK];
+}
+
+
+bool FrozenCatalogue::IsRouteCircular(RouteId route_id) const
+{
+	return routes_[route_id >> CHUNK_BITS]->is_circular[route_id & CHUNK_MASK] != 0;
+}
+
+
+RouteTraversal FrozenCatalogue::GetRouteStops(RouteId route_id) const
+{
+	const RoutesChunk& chunk = *routes_[route_id >> CHUNK_BITS];
+	const size_t local = route_id & CHUNK_MASK;
+	return RouteTraversal(chunk.stops.data() + chunk.stops_offsets[local],
+						  chunk.stops_offsets[local + 1] - chunk.stops_offsets[local],
+						  chunk.is_circular[local] != 0);
+}
+
+
+const std::vector<RouteId>& FrozenCatalogue::GetRoutesByName() const
+{
+	return *routes_by_name_;
+}
+
+
+RegionId FrozenCatalogue::GetRouteRegion(RouteId route_id) const
+{
+	return routes_[route_id >> CHUNK_BITS]->regions[route_id & CHUNK_MASK];
+}
+
+
+bool FrozenCatalogue::IsStopBoundary(StopId stop_id) const
+{
+	return stops_[stop_id >> CHUNK_BITS]->is_boundary[stop_id & CHUNK_MASK] != 0;
+}
+
+
+size_t FrozenCatalogue::GetRegionsCount() const
+{
+	return region_names_.size();
+}
+
+
+std::string_view FrozenCatalogue::GetRegionName(RegionId region) const
+{
+	return region_names_[region];
+}
+
+
+std::optional<StopId> FrozenCatalogue::FindStop(std::string_view stop_name) const
+{
+	// Названия, которых нет в индексе, ищутся в словаре
+	if (!added_stop_names_.empty())
+	{
+		if (const auto it = added_stop_names_.find(stop_name); it != added_stop_names_.end())
+		{
+			return it->second;
+		}
+	}
+	// Индекс дает единственного кандидата, осталось сравнить название
+	const uint32_t id = name_indexes_->stops.FindCandidate(stop_name);
+	if (id == PerfectHashIndex::NO_ID || id >= stops_count_ || GetStopName(id) != stop_name)
+	{
+		return std::nullopt;
+	}
+	return id;
+}
+
+
+std::optional<RouteId> FrozenCatalogue::FindRoute(std::string_view route_name) const
+{
+	if (!added_route_names_.empty())
+	{
+		if (const auto it = added_route_names_.find(route_name); it != added_route_names_.end())
+		{
+			return it->second;
+		}
+	}
+	// Номер из индекса мог освободиться или перейти к другому маршруту - сравнение названий это отсеет
+	const uint32_t id = name_indexes_->routes.FindCandidate(route_name);
+	if (id == PerfectHashIndex::NO_ID || id >= routes_count_ || GetRouteName(id) != route_name)
+	{
+		return std::nullopt;
+	}
+	return id;
+}
+
+
+std::vector<NearbyStop> FrozenCatalogue::MakeNearbyStops(const std::vector<geo::NearbyPoint>& points) const
+{
+	std::vector<NearbyStop> result;
+	result.reserve(points.size());
+	for (const geo::NearbyPoint& point : points)
+	{
+		result.push_back({ GetStopName(point.index), point.distance });
+	}
+	return result;
+}
+
+
+std::vector<NearbyStop> FrozenCatalogue::FindNearestStops(geo::Coordinates center, size_t count) const
+{
+	return MakeNearbyStops(stops_spatial_index_->FindNearest(center, count));
+}
+
+
+std::vector<NearbyStop> FrozenCatalogue::FindStopsInRadius(geo::Coordinates center, double radius) const
+{
+	return MakeNearbyStops(stops_spatial_index_->FindInRadius(center, radius));
+}
+
+
+std::vector<NameSuggestion> FrozenCatalogue::SuggestNames(std::string_view query, size_t count, uint32_t max_edits) const
+{
+	const auto get_name = [this](const NameMatch& match)
+	{
+		return (match.kind == NameKind::STOP) ? GetStopName(match.id) : GetRouteName(match.id);
+	};
+	std::vector<NameMatch> matches;
+	if (added_stop_names_.empty() && added_route_names_.empty() && stale_routes_.empty())
+	{
+		matches = name_indexes_->suggest.Suggest(query, count, max_edits);
+	}
+	else if (count > 0)
+	{
+		// 1. Из индекса берем с запасом на устаревшие маршруты и отбрасываем их
+		matches = name_indexes_->suggest.Suggest(query, count + stale_routes_.size(), max_edits);
+		matches.erase(std::remove_if(matches.begin(), matches.end(), [this](const NameMatch& match)
+									 {
+										 return match.kind == NameKind::ROUTE
+											 && std::binary_search(stale_routes_.begin(), stale_routes_.end(), match.id);
+									 }),
+					  matches.end());
+		// 2. Названия вне индекса проверяются перебором
+		max_edits = std::min(max_edits, NameSuggestIndex::MAX_EDITS);
+		const std::u32string folded = NameSuggestIndex::Fold(query);
+		const auto add_matches = [&matches, &folded, max_edits](const auto& names, NameKind kind)
+		{
+			for (const auto& [name, id] : names)
+			{
+				const uint32_t edits = NameSuggestIndex::GetPrefixDistance(folded, name, max_edits);
+				if (edits <= max_edits)
+				{
+					matches.push_back(NameMatch{ kind, id, edits });
+				}
+			}
+		};
+		add_matches(added_stop_names_, NameKind::STOP);
+		add_matches(added_route_names_, NameKind::ROUTE);
+		// 3. Порядок индекса: по количеству исправлений, затем по приведенному названию
+		std::vector<std::pair<std::u32string, NameMatch>> keyed;
+		keyed.reserve(matches.size());
+		for (const NameMatch& match : matches)
+		{
+			keyed.emplace_back(NameSuggestIndex::Fold(get_name(match)), match);
+		}
+		std::sort(keyed.begin(), keyed.end(), [](const auto& lhs, const auto& rhs)
+				  {
+					  return std::tie(lhs.second.edits, lhs.first, lhs.second.kind, lhs.second.id)
+						  < std::tie(rhs.second.edits, rhs.first, rhs.second.kind, rhs.second.id);
+				  });
+		keyed.resize(std::min(keyed.size(), count));
+		matches.clear();
+		for (const auto& item : keyed)
+		{
+			matches.push_back(item.second);
+		}
+	}
+
+	std::vector<NameSuggestion> result;
+	result.reserve(matches.size());
+	for (const NameMatch& match : matches)
+	{
+		result.push_back({ get_name(match), match.kind, match.edits });
+	}
+	return result;
+}
+
+
+size_t FrozenCatalogue::GetDistance(StopId stop_from, StopId stop_to) const
+{
+	return distances_->Get(stop_from, stop_to);
+}
+
+
+RouteStatPtr FrozenCatalogue::GetRouteInfo(std::string_view route_name) const
+{
+	const auto id = FindRoute(route_name);
+	return id ? GetRouteStat(*id) : nullptr;
+}
+
+
+StopStatPtr FrozenCatalogue::GetBusesForStopInfo(std::string_view stop_name) const
+{
+	const auto id = FindStop(stop_name);
+	return id ? GetStopStat(*id) : nullptr;
+}
+
+
+StopStatPtr FrozenCatalogue::GetStopStat(StopId id) const
+{
+	return &stops_[id >> CHUNK_BITS]->stats[id & CHUNK_MASK];
+}
+
+
+RouteStatPtr FrozenCatalogue::GetRouteStat(RouteId id) const
+{
+	return &routes_[id >> CHUNK_BITS]->stats[id & CHUNK_MASK];
+}
+
+
+RendererData FrozenCatalogue::GetRendererData() const
+{
+	// Данные предыдущей версии, если карта не менялась, иначе строятся при первом запросе.
+	// Следующая версия может читать указатель одновременно с построением - отсюда атомарная запись
+	std::call_once(renderer_once_, [this]()
+		{
+			if (!renderer_)
+			{
+				std::atomic_store(&renderer_, BuildRendererStore());
+			}
+		});
+	const RendererStore& store = *renderer_;
+	return RendererData{ ranges::Range(store.routes.data(), store.routes.data() + store.routes.size()),
+						 ranges::Range(store.stop_names.data(), store.stop_names.data() + store.stop_names.size()),
+						 ranges::Range(store.stop_coords.data(), store.stop_coords.data() + store.stop_coords.size()),
+						 stops_coords_.get() };
+}
+
+
+
+void FrozenCatalogue::ReportMemory(memory_report::MemoryReport& report) const
+{
+	using namespace memory_report;
+	const std::string_view subsystem = "FrozenCatalogue";
+
+	// Арену названий учитывает каталог
+	size_t names = VectorBytes(region_names_);
+	size_t route_stops = VectorBytes(routes_) + VectorBytes(*routes_by_name_);
+	size_t regions = 0;
+	size_t stop_buses = VectorBytes(stops_);
+	size_t stats = 0;
+	for (const auto& chunk : stops_)
+	{
+		names += VectorBytes(chunk->names);
+		regions += VectorBytes(chunk->is_boundary);
+		stop_buses += VectorBytes(chunk->buses) + VectorBytes(chunk->buses_offsets);
+		stats += VectorBytes(chunk->stats);
+	}
+	for (const auto& chunk : routes_)
+	{
+		names += VectorBytes(chunk->names);
+		route_stops += VectorBytes(chunk->stops) + VectorBytes(chunk->stops_offsets) + VectorBytes(chunk->is_circular);
+		regions += VectorBytes(chunk->regions);
+		stats += VectorBytes(chunk->stats);
+	}
+	size_t renderer_data = 0;
+	if (const auto store = std::atomic_load(&renderer_))
+	{
+		renderer_data = VectorBytes(store->routes_chunks) + VectorBytes(store->routes) + VectorBytes(store->stop_names)
+			+ VectorBytes(store->stop_coords);
+	}
+
+	report.Add(subsystem, "names", names);
+	report.Add(subsystem, "coordinates", stops_coords_->GetMemoryUsage());
+	report.Add(subsystem, "spatial_index", stops_spatial_index_->GetMemoryUsage());
+	report.Add(subsystem, "route_stops", route_stops);
+	report.Add(subsystem, "regions", regions);
+	report.Add(subsystem, "distances", distances_->GetMemoryUsage());
+	report.Add(subsystem, "stop_buses", stop_buses);
+	report.Add(subsystem, "stats", stats);
+	report.Add(subsystem, "renderer_data", renderer_data);
+	report.Add(subsystem, "name_index", name_indexes_->stops.GetMemoryUsage() + name_indexes_->routes.GetMemoryUsage()
+			   + HashTableBytes(added_stop_names_) + HashTableBytes(added_route_names_) + VectorBytes(stale_routes_));
+	report.Add(subsystem, "suggest_index", name_indexes_->suggest.GetMemoryUsage());
+}
+
+}
@@ -0,0 +1,207 @@
+/*
+ * Назначение модуля: неизменяемый снимок каталога для режима запросов.
+ *
+ * Снимок строится из заполненного TransportCatalogue. Данные остановок и маршрутов лежат
+ * блоками по CHUNK_SIZE номеров StopId / RouteId, внутри блока - в непрерывных массивах:
+ *  - названия - ссылки в арену названий каталога, которую снимки держат вместе с ним;
+ *  - остановки маршрутов (так, как маршруты заданы) и маршруты остановок - в формате CSR
+ *    (общий массив блока и смещения);
+ *  - готовые ответы на запросы Bus / Stop - в векторах блока.
+ * Координаты остановок - структура массивов geo::CoordinatesArray. Данные карты (маршруты
+ * и их остановки по алфавиту) строятся при первом запросе карты к снимку, и RendererData
+ * ссылается на них, так что запрос Map не копирует ни названий, ни координат.
+ * Поиск по названию - индекс на совершенной хэш-функции, поиск остановок рядом с точкой -
+ * пространственный индекс geo::SpatialIndex, подсказки по началу названия - NameSuggestIndex.
+ * Подсистемы режима запросов
+ * (RequestHandler, MapRenderer через него, TransportRouter, Raptor) читают только снимок.
+ *
+ * Снимок изменившегося каталога строится по предыдущему: из каталога перестраиваются только
+ * блоки с затронутыми остановками и маршрутами, остальные блоки, координаты (вместе с
+ * пространственным индексом), расстояния и данные карты, не затронутые изменением, снимок
+ * разделяет с предыдущим. Индексы названий тоже разделяются: названия, добавленные или
+ * сменившие номер после построения индексов, ищутся в небольших словарях снимка, а индексы
+ * перестраиваются, когда таких названий накопилось NAME_OVERLAY_LIMIT.
+ */
+
+#pragma once
+
+#include "transport_catalogue.h"
+#include "name_suggest.h"
+#include "spatial_index.h"
+#include "string_arena.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace transport_catalogue
+{
+
+// Остановка рядом с точкой и расстояние до нее по поверхности, метров
+struct NearbyStop
+{
+	std::string_view name;
+	double distance = 0.0;
+};
+
+// Подсказка названия: название, его вид и количество исправлений запроса
+struct NameSuggestion
+{
+	std::string_view name;
+	NameKind kind = NameKind::STOP;
+	uint32_t edits = 0;
+};
+
+// ----------- FrozenCatalogue ---------------
+
+class FrozenCatalogue
+{
+public:
+	explicit FrozenCatalogue(const TransportCatalogue&);
+	// Снимок изменившегося каталога. Не затронутые изменениями данные берутся у предыдущего снимка
+	FrozenCatalogue(const TransportCatalogue&, const FrozenCatalogue& previous, CatalogueChanges);
+	// Ответы ссылаются на собственные массивы снимка - копирование запрещено
+	FrozenCatalogue(const FrozenCatalogue&) = delete;
+	FrozenCatalogue& operator=(const FrozenCatalogue&) = delete;
+
+	size_t GetStopsCount() const;
+	size_t GetRoutesCount() const;
+
+	std::string_view GetStopName(StopId) const;
+	geo::Coordinates GetStopCoordinates(StopId) const;
+	const geo::CoordinatesArray& GetStopsCoordinates() const;
+
+	std::string_view GetRouteName(RouteId) const;
+	bool IsRouteCircular(RouteId) const;
+	// Остановки в порядке движения: для некольцевого маршрута включает обратное направление
+	RouteTraversal GetRouteStops(RouteId) const;
+	// Номера маршрутов в порядке их названий
+	const std::vector<RouteId>& GetRoutesByName() const;
+
+	// Регионы: маршрут принадлежит одному региону, пограничная остановка связывает маршруты разных регионов
+	RegionId GetRouteRegion(RouteId) const;
+	bool IsStopBoundary(StopId) const;
+	size_t GetRegionsCount() const;    // Включая регион по умолчанию
+	std::string_view GetRegionName(RegionId) const;
+
+	// Номер остановки / маршрута по названию (nullopt - название не найдено)
+	std::optional<StopId> FindStop(std::string_view) const;
+	std::optional<RouteId> FindRoute(std::string_view) const;
+
+	// Не более count ближайших к точке остановок в порядке возрастания расстояния
+	std::vector<NearbyStop> FindNearestStops(geo::Coordinates, size_t count) const;
+	// Остановки не дальше radius метров от точки в порядке возрастания расстояния
+	std::vector<NearbyStop> FindStopsInRadius(geo::Coordinates, double radius) const;
+
+	// Не более count названий остановок и маршрутов, начинающихся с query с точностью
+	// до max_edits опечаток (см. NameSuggestIndex::Suggest)
+	std::vector<NameSuggestion> SuggestNames(std::string_view query, size_t count, uint32_t max_edits) const;
+
+	size_t GetDistance(StopId, StopId) const;    // Расстояние с перестановкой пары, как в TransportCatalogue
+
+	// Возвращают указатели на готовые ответы, которые живут вместе со снимком (nullptr - имя не найдено)
+	RouteStatPtr GetRouteInfo(std::string_view) const;
+	StopStatPtr GetBusesForStopInfo(std::string_view) const;
+	// Готовые ответы по номеру остановки / маршрута
+	StopStatPtr GetStopStat(StopId) const;
+	RouteStatPtr GetRouteStat(RouteId) const;
+
+	// Данные для рендерера карт. Ссылаются на массивы снимка и живут вместе с ним
+	RendererData GetRendererData() const;
+
+	// Добавляет в отчет память структур снимка. Разделяемые с другими снимками блоки,
+	// координаты, расстояния и индексы учитываются полностью, арену названий учитывает каталог
+	void ReportMemory(memory_report::MemoryReport&) const;
+
+private:
+	// Блок - номера [i * CHUNK_SIZE, (i + 1) * CHUNK_SIZE). Блок не меняется после построения
+	static constexpr size_t CHUNK_BITS = 8;
+	static constexpr size_t CHUNK_SIZE = size_t{ 1 } << CHUNK_BITS;
+	static constexpr size_t CHUNK_MASK = CHUNK_SIZE - 1;
+	// Сколько названий может отсутствовать в индексах, прежде чем индексы будут перестроены
+	static constexpr size_t NAME_OVERLAY_LIMIT = 256;
+
+	// Остановки блока и ответы о них. Маршруты остановки i блока (названия по алфавиту) -
+	// [buses_offsets[i], buses_offsets[i + 1])
+	struct StopsChunk
+	{
+		std::vector<std::string_view> names;
+		std::vector<char> is_boundary;
+		std::vector<std::string_view> buses;
+		std::vector<uint32_t> buses_offsets;
+		std::vector<StopStat> stats;
+	};
+	// Маршруты блока и ответы о них. Остановки маршрута i блока так, как он задан, -
+	// [stops_offsets[i], stops_offsets[i + 1])
+	struct RoutesChunk
+	{
+		std::vector<std::string_view> names;
+		std::vector<StopId> stops;
+		std::vector<uint32_t> stops_offsets;
+		std::vector<char> is_circular;
+		std::vector<RegionId> regions;
+		std::vector<RouteStat> stats;
+	};
+	// Индексы по названиям остановок и маршрутов одной из версий (номер - позиция названия)
+	struct NameIndexes
+	{
+		PerfectHashIndex stops;
+		PerfectHashIndex routes;
+		NameSuggestIndex suggest;
+		size_t routes_count = 0;
+	};
+	// Данные карты: непустые маршруты и остановки на них по алфавиту (см. RendererData).
+	// Маршруты ссылаются на остановки в блоках, поэтому данные держат эти блоки
+	struct RendererStore
+	{
+		std::vector<std::shared_ptr<const RoutesChunk>> routes_chunks;
+		std::vector<RendererRoute> routes;
+		std::vector<std::string_view> stop_names;
+		std::vector<geo::Coordinates> stop_coords;
+	};
+
+	// Перестраивает из каталога блоки, в которые попадают номера (номера вне снимка пропускаются)
+	void RebuildStopsChunks(const TransportCatalogue&, std::vector<StopId> ids);
+	void RebuildRoutesChunks(const TransportCatalogue&, std::vector<RouteId> ids);
+	// Дописывает в порядок маршрутов по названию маршруты, сменившие название (renamed
+	// отсортирован). Маршруты с прежними названиями с этих номеров из порядка убираются
+	void UpdateRoutesByName(const FrozenCatalogue& previous, const std::vector<RouteId>& renamed);
+	// Учитывает добавленные остановки и маршруты, сменившие название, в словарях названий
+	// вне индексов. Перестраивает индексы, если таких названий стало слишком много
+	void UpdateNameIndexes(const FrozenCatalogue& previous, const std::vector<RouteId>& renamed);
+	// Строит индексы по всем названиям снимка. Если передан замороженный каталог с теми же
+	// названиями, берет параметры хэш-функций у него
+	void BuildNameIndexes(const TransportCatalogue* frozen_tc);
+	std::shared_ptr<const RendererStore> BuildRendererStore() const;
+	std::vector<NearbyStop> MakeNearbyStops(const std::vector<geo::NearbyPoint>&) const;
+
+	std::shared_ptr<const StringArena> names_;    // Арена названий каталога: названия снимка ссылаются в нее
+	size_t stops_count_ = 0;
+	size_t routes_count_ = 0;
+	std::vector<std::shared_ptr<const StopsChunk>> stops_;      // Блоки остановок (разделяемые)
+	std::vector<std::shared_ptr<const RoutesChunk>> routes_;    // Блоки маршрутов (разделяемые)
+	std::vector<std::string_view> region_names_;
+
+	std::shared_ptr<const geo::CoordinatesArray> stops_coords_;    // Координаты остановок по номеру (разделяемые)
+	std::shared_ptr<const geo::SpatialIndex> stops_spatial_index_;    // Индекс координат (разделяемый вместе с ними)
+	std::shared_ptr<const DistanceStore> distances_;    // Расстояния (разделяемые)
+	std::shared_ptr<const std::vector<RouteId>> routes_by_name_;    // Номера маршрутов по алфавиту (разделяемые)
+
+	// Индексы названий (разделяемые) и названия, которых в индексах нет: добавленные после
+	// построения индексов и сменившие номер. Маршруты индексов, номер которых с тех пор
+	// занят другим названием или освобожден, - в stale_routes_ (по возрастанию)
+	std::shared_ptr<const NameIndexes> name_indexes_;
+	std::unordered_map<std::string_view, StopId> added_stop_names_;
+	std::unordered_map<std::string_view, RouteId> added_route_names_;
+	std::vector<RouteId> stale_routes_;
+
+	// Данные карты: от предыдущей версии или строятся при первом запросе карты
+	mutable std::once_flag renderer_once_;
+	mutable std::shared_ptr<const RendererStore> renderer_;    // Доступ между версиями - std::atomic_load / std::atomic_store
+};
+
+}
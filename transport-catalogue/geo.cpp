@@ -1,12 +1,94 @@
 #define _USE_MATH_DEFINES  // Для константы Пи
 
 #include "geo.h"
+#include "memory_report.h"
 
+#include <algorithm>
 #include <cmath>
 
+// Пакетное ядро AVX2 собирается только компиляторами с поддержкой атрибута target,
+// выбор между ним и скалярным вариантом делается во время выполнения
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GEO_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
 namespace geo
 {
 
+namespace
+{
+
+const double DEG_TO_RAD = M_PI / 180.;
+
+// Количество отрезков, обрабатываемых за один проход ComputePathLength
+const size_t PATH_CHUNK = 256;
+
+// cos центрального угла между точками a и b. Порядок операций совпадает с ядром AVX2
+inline double CosAngle(const double* sin_lat, const double* cos_lat, const double* sin_lng, const double* cos_lng,
+                       uint32_t a, uint32_t b)
+{
+    const double cos_dlng = cos_lng[a] * cos_lng[b] + sin_lng[a] * sin_lng[b];
+    return sin_lat[a] * sin_lat[b] + (cos_lat[a] * cos_lat[b]) * cos_dlng;
+}
+
+void ComputeCosAnglesScalar(const double* sin_lat, const double* cos_lat, const double* sin_lng, const double* cos_lng,
+                            const uint32_t* path, size_t count, double* out)
+{
+    for (size_t i = 0; i + 1 < count; ++i)
+    {
+        out[i] = CosAngle(sin_lat, cos_lat, sin_lng, cos_lng, path[i], path[i + 1]);
+    }
+}
+
+#ifdef GEO_AVX2_KERNEL
+// Gather 4 значений base[idx[k]]. Форма с маской и нулевым исходным регистром: у
+// _mm256_i32gather_pd исходный регистр не инициализирован, на что GCC выдает
+// -Wmaybe-uninitialized
+__attribute__((target("avx2")))
+inline __m256d Gather(const double* base, __m128i idx)
+{
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, idx, all, 8);
+}
+
+// 4 отрезка за итерацию: номера концов загружаются двумя смещенными на 1 чтениями,
+// данные точек собираются gather-инструкциями. FMA не используется, чтобы результат
+// совпадал со скалярным вариантом бит в бит
+__attribute__((target("avx2")))
+void ComputeCosAnglesAvx2(const double* sin_lat, const double* cos_lat, const double* sin_lng, const double* cos_lng,
+                          const uint32_t* path, size_t count, double* out)
+{
+    size_t i = 0;
+    for (; i + 4 < count; i += 4)
+    {
+        const __m128i from = _mm_loadu_si128(reinterpret_cast<const __m128i*>(path + i));
+        const __m128i to = _mm_loadu_si128(reinterpret_cast<const __m128i*>(path + i + 1));
+
+        const __m256d cos_dlng = _mm256_add_pd(
+            _mm256_mul_pd(Gather(cos_lng, from), Gather(cos_lng, to)),
+            _mm256_mul_pd(Gather(sin_lng, from), Gather(sin_lng, to)));
+        const __m256d sin_sin = _mm256_mul_pd(Gather(sin_lat, from), Gather(sin_lat, to));
+        const __m256d cos_cos = _mm256_mul_pd(Gather(cos_lat, from), Gather(cos_lat, to));
+
+        _mm256_storeu_pd(out + i, _mm256_add_pd(sin_sin, _mm256_mul_pd(cos_cos, cos_dlng)));
+    }
+    // Сбрасываем старшие половины регистров: иначе последующий SSE-код (в том числе acos
+    // из libm) платит за смену состояния AVX на каждой инструкции
+    _mm256_zeroupper();
+    // Хвост короче 4 отрезков
+    ComputeCosAnglesScalar(sin_lat, cos_lat, sin_lng, cos_lng, path + i, count - i, out + i);
+}
+
+bool HasAvx2()
+{
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+}
+#endif
+
+} // namespace
+
 bool Coordinates::operator==(const Coordinates& other) const
 {
     return lat == other.lat && lng == other.lng;
@@ -35,4 +117,99 @@ double ComputeDistance(Coordinates from, Coordinates to)
         * EARTH_RADIUS;
 }
 
+// ----------- CoordinatesArray ---------------
+
+void CoordinatesArray::Add(Coordinates coords)
+{
+    lat_.push_back(coords.lat);
+    lng_.push_back(coords.lng);
+    sin_lat_.push_back(std::sin(coords.lat * DEG_TO_RAD));
+    cos_lat_.push_back(std::cos(coords.lat * DEG_TO_RAD));
+    sin_lng_.push_back(std::sin(coords.lng * DEG_TO_RAD));
+    cos_lng_.push_back(std::cos(coords.lng * DEG_TO_RAD));
+}
+
+void CoordinatesArray::Reserve(size_t count)
+{
+    for (auto* column : { &lat_, &lng_, &sin_lat_, &cos_lat_, &sin_lng_, &cos_lng_ })
+    {
+        column->reserve(count);
+    }
+}
+
+void CoordinatesArray::Set(size_t index, Coordinates coords)
+{
+    lat_[index] = coords.lat;
+    lng_[index] = coords.lng;
+    sin_lat_[index] = std::sin(coords.lat * DEG_TO_RAD);
+    cos_lat_[index] = std::cos(coords.lat * DEG_TO_RAD);
+    sin_lng_[index] = std::sin(coords.lng * DEG_TO_RAD);
+    cos_lng_[index] = std::cos(coords.lng * DEG_TO_RAD);
+}
+
+size_t CoordinatesArray::Size() const
+{
+    return lat_.size();
+}
+
+size_t CoordinatesArray::GetMemoryUsage() const
+{
+    using memory_report::VectorBytes;
+    return VectorBytes(lat_) + VectorBytes(lng_) + VectorBytes(sin_lat_) + VectorBytes(cos_lat_)
+        + VectorBytes(sin_lng_) + VectorBytes(cos_lng_);
+}
+
+Coordinates CoordinatesArray::Get(size_t index) const
+{
+    return { lat_[index], lng_[index] };
+}
+
+void CoordinatesArray::ComputeCosAngles(const uint32_t* path, size_t count, double* out) const
+{
+#ifdef GEO_AVX2_KERNEL
+    if (HasAvx2())
+    {
+        ComputeCosAnglesAvx2(sin_lat_.data(), cos_lat_.data(), sin_lng_.data(), cos_lng_.data(), path, count, out);
+        return;
+    }
+#endif
+    ComputeCosAnglesScalar(sin_lat_.data(), cos_lat_.data(), sin_lng_.data(), cos_lng_.data(), path, count, out);
+}
+
+void CoordinatesArray::ComputePathDistances(const uint32_t* path, size_t count, double* out) const
+{
+    if (count < 2)
+    {
+        return;
+    }
+    ComputeCosAngles(path, count, out);
+    for (size_t i = 0; i + 1 < count; ++i)
+    {
+        const uint32_t from = path[i];
+        const uint32_t to = path[i + 1];
+        // Совпадающие точки дают ровно 0, как в ComputeDistance. Ограничение аргумента
+        // защищает acos от выхода за [-1, 1] из-за округления
+        out[i] = (lat_[from] == lat_[to] && lng_[from] == lng_[to])
+            ? 0.
+            : std::acos(std::clamp(out[i], -1., 1.)) * EARTH_RADIUS;
+    }
+}
+
+double CoordinatesArray::ComputePathLength(const uint32_t* path, size_t count) const
+{
+    double length = 0.;
+    double distances[PATH_CHUNK];
+    // Соседние порции пересекаются на одну точку, чтобы не потерять отрезок на стыке
+    for (size_t begin = 0; begin + 1 < count; begin += PATH_CHUNK)
+    {
+        const size_t chunk = std::min(PATH_CHUNK + 1, count - begin);
+        ComputePathDistances(path + begin, chunk, distances);
+        for (size_t i = 0; i + 1 < chunk; ++i)
+        {
+            length += distances[i];
+        }
+    }
+    return length;
+}
+
 }
@@ -4,6 +4,8 @@
 // Обычно size_t определяется в заголовках с контейнерами STL, но при их отсутствии 
 // может вызвать ошибку. В этом случае нужно добавить #include <cstddef>
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace geo
 {
@@ -31,4 +33,44 @@ public:
 // земного шара
 double ComputeDistance(Coordinates from, Coordinates to);
 
+// Координаты набора точек в виде структуры массивов: широты, долготы и их синусы
+// и косинусы лежат в отдельных непрерывных векторах. Тригонометрия считается один
+// раз при добавлении точки, а расстояния вдоль пути считаются пакетно (AVX2, если
+// процессор его поддерживает, иначе скалярно - результаты обоих вариантов совпадают).
+//
+// Отличие от ComputeDistance: cos разности долгот раскладывается по формуле косинуса
+// разности, поэтому аргумент acos может отличаться на несколько ULP. Около 1 acos плохо
+// обусловлен, и для отдельного короткого отрезка (сотни метров) расстояния расходятся
+// до 1e-6 относительных; на длине маршрута расхождения взаимно гасятся (порядка 1e-14)
+class CoordinatesArray
+{
+public:
+    // Добавляет точку, ее номер - текущий размер массива
+    void Add(Coordinates coords);
+    void Reserve(size_t count);
+    // Заменяет координаты точки index
+    void Set(size_t index, Coordinates coords);
+    size_t Size() const;
+    Coordinates Get(size_t index) const;
+    // Динамическая память массивов, байт
+    size_t GetMemoryUsage() const;
+
+    // Расстояния между соседними точками пути из count номеров:
+    // out[i] = расстояние path[i] -> path[i + 1], i < count - 1
+    void ComputePathDistances(const uint32_t* path, size_t count, double* out) const;
+    // Длина пути - сумма расстояний между соседними точками (в порядке обхода)
+    double ComputePathLength(const uint32_t* path, size_t count) const;
+
+private:
+    std::vector<double> lat_;        // Широты, градусы
+    std::vector<double> lng_;        // Долготы, градусы
+    std::vector<double> sin_lat_;
+    std::vector<double> cos_lat_;
+    std::vector<double> sin_lng_;
+    std::vector<double> cos_lng_;
+
+    // Заполняет out[i] косинусами центральных углов между path[i] и path[i + 1]
+    void ComputeCosAngles(const uint32_t* path, size_t count, double* out) const;
+};
+
 }  // namespace geo
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "memory_report.h"
 #include "ranges.h"
 
 #include <cstdlib>
+#include <string_view>
 #include <vector>
 
 namespace graph
@@ -25,7 +27,7 @@ struct Edge
     VertexId from;
     VertexId to;
     Weight weight;
-    std::string edge_name;    // Extras. Либо название остановки (если едем), либо имя маршрута (если ждем)
+    std::string_view edge_name;    // Extras. Либо название остановки (если едем), либо имя маршрута (если ждем). Не владеет строкой
     EdgeType type;            // Extras. Тип ребра
     int span_count = 0;       // Extras. Количество остановок без пересадок
 };
@@ -47,6 +49,9 @@ public:
     const Edge<Weight>& GetEdge(EdgeId edge_id) const;
     IncidentEdgesRange GetIncidentEdges(VertexId vertex) const;
 
+    // Добавляет в отчет память ребер и списков смежности
+    void ReportMemory(memory_report::MemoryReport& report) const;
+
 private:
     std::vector<Edge<Weight>> edges_;
     std::vector<IncidenceList> incidence_lists_;
@@ -91,4 +96,11 @@ DirectedWeightedGraph<Weight>::GetIncidentEdges(VertexId vertex) const
 {
     return ranges::AsRange(incidence_lists_.at(vertex));
 }
+
+template <typename Weight>
+void DirectedWeightedGraph<Weight>::ReportMemory(memory_report::MemoryReport& report) const
+{
+    report.Add("DirectedWeightedGraph", "edges", memory_report::VectorBytes(edges_));
+    report.Add("DirectedWeightedGraph", "incidence_lists", memory_report::NestedVectorBytes(incidence_lists_));
+}
 }  // namespace graph
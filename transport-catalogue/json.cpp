@@ -307,6 +307,33 @@ struct PrintContext
 
 void PrintNode(const Node& value, const PrintContext& ctx);
 
+// Память, которой владеет узел (сам узел учтен в массиве или словаре родителя)
+void ReportNodeMemory(const Node& node, memory_report::MemoryReport& report)
+{
+    using namespace memory_report;
+    if (node.IsString())
+    {
+        report.Add("json::Document"sv, "strings"sv, StringBytes(node.AsString()));
+    }
+    else if (node.IsArray())
+    {
+        report.Add("json::Document"sv, "arrays"sv, VectorBytes(node.AsArray()));
+        for (const Node& item : node.AsArray())
+        {
+            ReportNodeMemory(item, report);
+        }
+    }
+    else if (node.IsDict())
+    {
+        report.Add("json::Document"sv, "dicts"sv, TreeBytes(node.AsDict()));
+        for (const auto& [key, value] : node.AsDict())
+        {
+            report.Add("json::Document"sv, "strings"sv, StringBytes(key));
+            ReportNodeMemory(value, report);
+        }
+    }
+}
+
 template <typename Value>
 void PrintValue(const Value& value, const PrintContext& ctx)
 {
@@ -436,6 +463,12 @@ void Print(const Document& doc, std::ostream& output)
     PrintNode(doc.GetRoot(), PrintContext{ output });
 }
 
+void Document::ReportMemory(memory_report::MemoryReport& report) const
+{
+    report.Add("json::Document"sv, "root"sv, sizeof(Node));
+    ReportNodeMemory(root_, report);
+}
+
 Node::Node(Value value) : variant(std::move(value))
 {}
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "memory_report.h"
+
 #include <iostream>
 #include <map>
 #include <string>
@@ -158,6 +160,9 @@ public:
         return root_;
     }
 
+    // Добавляет в отчет память дерева документа: узлы массивов, узлы словарей, строки
+    void ReportMemory(memory_report::MemoryReport& report) const;
+
 private:
     Node root_;
 };
@@ -14,6 +14,14 @@
 namespace json_reader
 {
 
+namespace
+{
+
+// Оценка памяти описаний на одну запись base_requests (описание и его векторы)
+const size_t LOAD_ARENA_BYTES_PER_RECORD = 128;
+
+} // namespace
+
 /*
 enum class ParseMode
 {
@@ -27,7 +35,8 @@ enum class ParseMode
 
 void ProcessBaseJSON(transport_catalogue::TransportCatalogue& tc,
 				 map_renderer::MapRenderer& mr,
-				 std::istream& input)
+				 std::istream& input,
+				 std::ostream* memory_report_output /*= nullptr*/)
 {
 	using namespace std::literals;
 
@@ -51,10 +60,15 @@ void ProcessBaseJSON(transport_catalogue::TransportCatalogue& tc,
 		ReadRendererSettings(mr, renderer_settings_it->second.AsDict());
 	}
 
+	// Каталог полностью заполнен - строим хэш-функции по названиям, чтобы сохранить их в базе
+	tc.Freeze();
+	// Роутер работает с неизменяемым снимком каталога
+	const transport_catalogue::FrozenCatalogue frozen_tc(tc);
+
 	// Создаем объект роутера. Создаем здесь, т.к. инициализация графа
 	// роутера требует информации о количестве вершин (они же - остановки),
 	// информация о которых к этому моменту уже загружена
-	router::TransportRouter tr(tc);
+	router::TransportRouter tr(frozen_tc);
 
 	// Находим точку начала секции настроек роутера в словаре (если есть)
 	const auto router_settings_it = j_dict.find("routing_settings"s);
@@ -64,6 +78,10 @@ void ProcessBaseJSON(transport_catalogue::TransportCatalogue& tc,
 		ReadRouterSettings(tr, router_settings_it->second.AsDict());
 	}
 
+	// Разбиение остановок для CRP не зависит от метрики, поэтому строится
+	// один раз при создании базы и сохраняется вместе с ней
+	tr.BuildPartition();
+
 	// Проверка секции настроек сериализации.
 	const auto serialization_settings_it = j_dict.find("serialization_settings"s);
 	if (serialization_settings_it != j_dict.cend())
@@ -74,11 +92,19 @@ void ProcessBaseJSON(transport_catalogue::TransportCatalogue& tc,
 		serialization::Serializer serializer(tc, mr, &tr);
 		serializer.Serialize(serialization_filename);
 	}
+
+	if (memory_report_output)
+	{
+		const transport_catalogue::RequestHandler rh(frozen_tc, mr);
+		CollectMemoryReport(tc, rh, tr, j_doc).Print(*memory_report_output);
+	}
 }
 
 void ProcessRequestJSON(transport_catalogue::TransportCatalogue& tc,
 				 map_renderer::MapRenderer& mr,
-				 std::istream& input, std::ostream& output)
+				 std::istream& input, std::ostream& output,
+				 std::ostream* memory_report_output /*= nullptr*/,
+				 std::ostream* router_log_output /*= nullptr*/)
 {
 	using namespace std::literals;
 
@@ -86,12 +112,8 @@ void ProcessRequestJSON(transport_catalogue::TransportCatalogue& tc,
 	// Корневой узел JSON документа - словарь
 	const json::Dict j_dict = j_doc.GetRoot().AsDict();
 
-	// Создаем обработчик запросов для справочника
-	transport_catalogue::RequestHandler rh(tc, mr);
-
-	// Нельзя создать объект роутера, т.к. справочник пока еще пуст.
-	// Создание роутера и обработка запросов будут производиться
-	// внутри ветки десериализации
+	// Нельзя создать обработчик запросов и объект роутера, т.к. справочник пока еще пуст.
+	// Их создание и обработка запросов будут производиться внутри ветки десериализации
 
 	// Проверка секции настроек сериализации.
 	const auto serialization_settings_it = j_dict.find("serialization_settings"s);
@@ -105,8 +127,16 @@ void ProcessRequestJSON(transport_catalogue::TransportCatalogue& tc,
 		serialization::Serializer serializer(tc, mr, nullptr);
 		serializer.Deserialize(serialization_filename);
 
+		// Обработчик запросов и роутер работают с неизменяемой версией справочника.
+		// Запросы изменения меняют сам справочник, после чего публикуется новая версия.
+		// frozen_tc удерживает версию, на которую ссылаются обработчик и роутер
+		transport_catalogue::CatalogueVersions versions(tc);
+		transport_catalogue::FrozenCataloguePtr frozen_tc = versions.Acquire();
+		transport_catalogue::RequestHandler rh(*frozen_tc, mr);
+
 		// Создаем объект роутера на основе уже десериализованного каталога.
-		router::TransportRouter tr(tc);
+		router::TransportRouter tr(*frozen_tc);
+		tr.SetDiagnosticsOutput(router_log_output);
 
 		// Передаем указатель на роутер и завершаем десериализацию
 		serializer.DeserializeRouter(&tr);
@@ -116,113 +146,131 @@ void ProcessRequestJSON(transport_catalogue::TransportCatalogue& tc,
 		if (stat_requests_it != j_dict.cend())
 		{
 			// Есть запросы к справочнику. Формат данных - массив (вектор)
-			ParseRawJSONQueries(rh, tr, stat_requests_it->second.AsArray(), output);
+			const json::Array& j_arr = stat_requests_it->second.AsArray();
+
+			// Количество запросов маршрутов нужно роутеру для выбора алгоритма
+			const size_t route_queries = std::count_if(j_arr.begin(), j_arr.end(), [](const json::Node& query)
+				{
+					const auto request_type = query.AsDict().find("type"s);
+					return request_type != query.AsDict().cend() && request_type->second.AsString() == "Route"s;
+				});
+			if (route_queries > 0)
+			{
+				// Роутер строится в фоне, пока обрабатываются запросы Bus/Stop/Map.
+				// Запросы Route дождутся его готовности
+				tr.SetExpectedRouteQueries(route_queries);
+				tr.StartBuildAsync();
+			}
+			ParseRawJSONQueries(tc, versions, frozen_tc, rh, tr, j_doc, j_arr, output);
+		}
+
+		if (memory_report_output)
+		{
+			CollectMemoryReport(tc, rh, tr, j_doc).Print(*memory_report_output);
 		}
 	}
 }
 
+memory_report::MemoryReport CollectMemoryReport(const transport_catalogue::TransportCatalogue& tc,
+												const transport_catalogue::RequestHandler& rh,
+												router::TransportRouter& tr,
+												const json::Document& j_doc)
+{
+	memory_report::MemoryReport report;
+	tc.ReportMemory(report);
+	rh.ReportMemory(report);
+	tr.ReportMemory(report);
+	j_doc.ReportMemory(report);
+	return report;
+}
+
 //------------------Process data-------------------
 
 void AddToDB(transport_catalogue::TransportCatalogue& tc, const json::Array& j_arr)
 {
 	// Каждый элемент массива входных данных j_arr - словарь.
+	// Описания ссылаются на строки j_arr, который живет до конца загрузки
 
 	using namespace std::literals;
 
-	// Вектор значений словаря, обрабатываемых в соответствующем проходе обработки входных данных,
-	// т.е. в 0-й проход проверяем на =="Stop", в 1й на =="Stop", во 2й на =="Bus"
-	static std::vector<std::string> stages = { "Stop"s, "Stop"s, "Bus"s };
+	// Описания нужны только на время загрузки: все их векторы выделяются из арены этапа
+	// загрузки и освобождаются разом при выходе из функции. Размер первого блока - оценка
+	// по количеству записей, чтобы арена не наращивала блоки с самого малого
+	std::pmr::monotonic_buffer_resource load_arena(j_arr.size() * LOAD_ARENA_BYTES_PER_RECORD);
+	std::pmr::vector<transport_catalogue::StopDescription> stops(&load_arena);
+	std::pmr::vector<transport_catalogue::RouteDescription> routes(&load_arena);
 
-	// Обработка j_arr в несколько проходов в строго определенной последовательности.
-	// В каждом проходе обрабатывается своя отдельная группа данных
-	for (size_t i = 0; i < stages.size(); ++i)
+	for (const auto& element : j_arr)
 	{
-		for (const auto& element : j_arr)
+		// Ищем ключ "type", хранящий тип записи
+		const auto request_type = element.AsDict().find("type"s);
+		if (request_type != element.AsDict().end())
 		{
-			// Ищем ключ "type", хранящий тип записи
-			const auto request_type = element.AsDict().find("type"s);
-			if (request_type != element.AsDict().end())
+			if (request_type->second.AsString() == "Stop"s)
 			{
-				// Для каждой пары проверяем соответствие Value i-му значению вектора stages
-				// При соответствии вызываем отдельную для каждого прохода функцию обработки
-				if (request_type->second.AsString() == stages[i])
-				{
-					switch (i)
-					{
-					case 0:
-						// Это остановка (тип записи - словарь). Обрабатываем название и координаты 
-						AddStopData(tc, element.AsDict());
-						break;
-					case 1:
-						// Это остановка (тип записи - словарь). Обрабатываем расстояния 
-						AddStopDistance(tc, element.AsDict());
-						break;
-					case 2:
-						// Это маршрут (тип записи - словарь). Обрабатываем полностью
-						AddRouteData(tc, element.AsDict());
-						break;
-					}
-				}
+				// Это остановка (тип записи - словарь). Название, координаты и расстояния
+				stops.push_back(ReadStopData(element.AsDict(), &load_arena));
+			}
+			else if (request_type->second.AsString() == "Bus"s)
+			{
+				// Это маршрут (тип записи - словарь)
+				routes.push_back(ReadRouteData(element.AsDict(), &load_arena));
 			}
 		}
 	}
-}
-
-void AddStopData(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
-{
-	using namespace std::literals;
-
-	const std::string stop_name = j_dict.at("name"s).AsString();
-	const double latitude = j_dict.at("latitude"s).AsDouble();
-	const double longitude = j_dict.at("longitude"s).AsDouble();
 
-	tc.AddStop(transport_catalogue::Stop{ stop_name, latitude, longitude });
+	// Порядок обработки (остановки, расстояния, маршруты) обеспечивает каталог
+	tc.AddBulk(stops, routes);
 }
 
-void AddStopDistance(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
+transport_catalogue::StopDescription ReadStopData(const json::Dict& j_dict, std::pmr::memory_resource* resource)
 {
 	using namespace std::literals;
 
-	const std::string from_stop_name = j_dict.at("name"s).AsString();
-	transport_catalogue::StopPtr from_ptr = tc.GetStopByName(from_stop_name);
-	// Продолжаем обработку только если остановка отправления есть в справочнике
-	if (from_ptr != nullptr)
+	// Название не копируется: каталог сам разместит его в своей арене
+	transport_catalogue::StopDescription stop(resource);
+	stop.name = j_dict.at("name"s).AsString();
+	stop.coords = geo::Coordinates{ j_dict.at("latitude"s).AsDouble(), j_dict.at("longitude"s).AsDouble() };
+	// Пограничная остановка (пересадка между регионами) отмечается явно
+	if (const auto boundary_it = j_dict.find("boundary"s); boundary_it != j_dict.end())
+	{
+		stop.is_boundary = boundary_it->second.AsBool();
+	}
+
+	// Расстояния до отсутствующих в справочнике остановок каталог пропустит
+	if (const auto distances_it = j_dict.find("road_distances"s); distances_it != j_dict.end())
 	{
-		const json::Dict stops = j_dict.at("road_distances"s).AsDict();
-		for (const auto& [to_stop_name, distance] : stops)
+		const json::Dict& distances = distances_it->second.AsDict();
+		stop.road_distances.reserve(distances.size());
+		for (const auto& [to_stop_name, distance] : distances)
 		{
-			tc.AddDistance(from_ptr, tc.GetStopByName(to_stop_name), static_cast<size_t>(distance.AsInt()));
+			stop.road_distances.emplace_back(to_stop_name, static_cast<size_t>(distance.AsInt()));
 		}
 	}
+	return stop;
 }
 
-void AddRouteData(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
+transport_catalogue::RouteDescription ReadRouteData(const json::Dict& j_dict, std::pmr::memory_resource* resource)
 {
-	// Алгоритм:
-	// 1. Создаем локальную переменную типа Route
-	// 2. Заполняем имя маршрута, тип и указатели на все остановки (nullptr отбрасываем)
-	// 3. Передаем Route через move в TC, который производит заполнение расчетных 
-	//    полей и перемещает итоговый объект в хранилище.
-
 	using namespace std::literals;
 
-	transport_catalogue::Route new_route;
-	new_route.route_name = j_dict.at("name"s).AsString();
-	new_route.is_circular = j_dict.at("is_roundtrip"s).AsBool();
-
-	// Формируем вектор указателей на остановки
-	for (auto& element : j_dict.at("stops"s).AsArray())
+	// Несуществующие остановки каталог отбросит. Маршрут может иметь и 0 (ноль) остановок,
+	// это валидный случай
+	transport_catalogue::RouteDescription route(resource);
+	route.name = j_dict.at("name"s).AsString();
+	route.is_circular = j_dict.at("is_roundtrip"s).AsBool();
+	// Маршрут без региона относится к региону по умолчанию
+	if (const auto region_it = j_dict.find("region"s); region_it != j_dict.end())
 	{
-		// Получаем либо указатель, либо nullptr
-		transport_catalogue::StopPtr tmp_ptr = tc.GetStopByName(element.AsString());
-		if (tmp_ptr != nullptr)
-		{
-			// Добавляем ТОЛЬКО существующие остановки (в данной версии)
-			new_route.stops.push_back(tmp_ptr);
-		}
+		route.region = region_it->second.AsString();
 	}
-	// Добавляем маршрут. Он может иметь и 0 (ноль) остановок, это валидный случай
-	tc.AddRoute(std::move(new_route));
+	const json::Array& stops = j_dict.at("stops"s).AsArray();
+	route.stops.reserve(stops.size());
+	for (const auto& element : stops)
+	{
+		route.stops.push_back(element.AsString());
+	}
+	return route;
 }
 
 //------------------Process settings-------------------
@@ -296,6 +344,40 @@ void ReadRouterSettings(router::TransportRouter& tr, const json::Dict& j_dict)
 	new_settings.bus_velocity = j_dict.at("bus_velocity").AsInt();
 	new_settings.bus_wait_time = j_dict.at("bus_wait_time").AsInt();
 
+	// Необязательные настройки алгоритма поиска маршрутов
+	const auto engine_it = j_dict.find("routing_engine");
+	if (engine_it != j_dict.cend())
+	{
+		if (engine_it->second.AsString() == "crp")
+		{
+			new_settings.engine = router::RouterEngine::CRP;
+		}
+		else if (engine_it->second.AsString() == "all_pairs")
+		{
+			new_settings.engine = router::RouterEngine::ALL_PAIRS;
+		}
+		else if (engine_it->second.AsString() == "auto")
+		{
+			new_settings.engine = router::RouterEngine::AUTO;
+		}
+		else
+		{
+			throw std::invalid_argument("Unknown routing_engine: " + engine_it->second.AsString());
+		}
+	}
+	if (const auto it = j_dict.find("crp_cell_size"); it != j_dict.cend())
+	{
+		new_settings.crp_cell_size = it->second.AsInt();
+	}
+	if (const auto it = j_dict.find("crp_levels"); it != j_dict.cend())
+	{
+		new_settings.crp_levels = it->second.AsInt();
+	}
+	if (const auto it = j_dict.find("memory_budget_mb"); it != j_dict.cend())
+	{
+		new_settings.memory_budget_mb = it->second.AsInt();
+	}
+
 	// Применяем новые настройки роутера
 	tr.ApplyRouterSettings(new_settings);
 }
@@ -308,8 +390,12 @@ const std::string ReadSerializationSettings(const json::Dict& j_dict)
 
 //--------------Processing requests-------------------
 
-void ParseRawJSONQueries(transport_catalogue::RequestHandler& rh, 
+void ParseRawJSONQueries(transport_catalogue::TransportCatalogue& tc,
+						 transport_catalogue::CatalogueVersions& versions,
+						 transport_catalogue::FrozenCataloguePtr& frozen_tc,
+						 transport_catalogue::RequestHandler& rh, 
 						 router::TransportRouter& tr, 
+						 const json::Document& j_doc,
 						 const json::Array& j_arr, 
 						 std::ostream& output)
 {
@@ -323,6 +409,31 @@ void ParseRawJSONQueries(transport_catalogue::RequestHandler& rh,
 		const auto request_type = query.AsDict().find("type"s);
 		if (request_type != query.AsDict().cend())
 		{
+			// Запросы изменения работают с самим справочником
+			if (request_type->second.AsString() == "UpdateStop"s)
+			{
+				processed_queries.emplace_back(ProcessUpdateStopQuery(tc, query.AsDict()));
+				continue;
+			}
+			else if (request_type->second.AsString() == "UpdateBus"s)
+			{
+				processed_queries.emplace_back(ProcessUpdateBusQuery(tc, query.AsDict()));
+				continue;
+			}
+			else if (request_type->second.AsString() == "RemoveBus"s)
+			{
+				processed_queries.emplace_back(ProcessRemoveBusQuery(tc, query.AsDict()));
+				continue;
+			}
+			else if (request_type->second.AsString() == "SetDistance"s)
+			{
+				processed_queries.emplace_back(ProcessSetDistanceQuery(tc, query.AsDict()));
+				continue;
+			}
+
+			// Запросы чтения работают с версией. Подряд идущие изменения дают одну новую версию
+			RefreshSnapshot(versions, frozen_tc, rh, tr);
+
 			// Есть поле типа запроса "type", обрабатываем
 			if (request_type->second.AsString() == "Stop"s)
 			{
@@ -340,11 +451,159 @@ void ParseRawJSONQueries(transport_catalogue::RequestHandler& rh,
 			{
 				processed_queries.emplace_back(ProcessRouteQuery(tr, query.AsDict()));
 			}
+			else if (request_type->second.AsString() == "NearestStops"s)
+			{
+				processed_queries.emplace_back(ProcessNearestStopsQuery(rh, query.AsDict()));
+			}
+			else if (request_type->second.AsString() == "StopsInRadius"s)
+			{
+				processed_queries.emplace_back(ProcessStopsInRadiusQuery(rh, query.AsDict()));
+			}
+			else if (request_type->second.AsString() == "Suggest"s)
+			{
+				processed_queries.emplace_back(ProcessSuggestQuery(rh, query.AsDict()));
+			}
+			else if (request_type->second.AsString() == "Analytics"s)
+			{
+				processed_queries.emplace_back(ProcessAnalyticsQuery(rh, query.AsDict()));
+			}
+			else if (request_type->second.AsString() == "Stats"s)
+			{
+				processed_queries.emplace_back(ProcessStatsQuery(tc, rh, tr, j_doc, query.AsDict()));
+			}
 		}
 	}
 	json::Print(json::Document{ processed_queries }, output);
 }
 
+void RefreshSnapshot(transport_catalogue::CatalogueVersions& versions,
+					 transport_catalogue::FrozenCataloguePtr& frozen_tc,
+					 transport_catalogue::RequestHandler& rh,
+					 router::TransportRouter& tr)
+{
+	// Изменения вносились в этом же потоке - внешняя синхронизация для Publish() соблюдена
+	const transport_catalogue::CatalogueChanges changes = versions.Publish();
+	if (!changes.Any())
+	{
+		return;
+	}
+	// Старая версия освобождается только после того, как все подсистемы переключились на новую
+	transport_catalogue::FrozenCataloguePtr new_frozen_tc = versions.Acquire();
+	tr.UpdateCatalogue(*new_frozen_tc, changes);
+	rh.SetCatalogue(*new_frozen_tc);
+	frozen_tc = std::move(new_frozen_tc);
+}
+
+// Ответ на успешный запрос изменения содержит только номер запроса
+json::Node MakeMutationAnswer(const json::Dict& j_dict, bool found)
+{
+	using namespace std::literals;
+
+	json::Builder builder;
+	builder.StartDict().Key("request_id"s).Value(j_dict.at("id"s).AsInt());
+	if (!found)
+	{
+		builder.Key("error_message"s).Value("not found"s);
+	}
+	return builder.EndDict().Build();
+}
+
+// Ответ на отклоненный запрос изменения: каталог остался прежним
+json::Node MakeMutationError(const json::Dict& j_dict, const std::string& message)
+{
+	using namespace std::literals;
+
+	return json::Builder{}
+		.StartDict()
+		.Key("request_id"s).Value(j_dict.at("id"s).AsInt())
+		.Key("error_message"s).Value(message)
+		.EndDict()
+		.Build();
+}
+
+const json::Node ProcessUpdateStopQuery(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	// Формат запроса совпадает с описанием остановки в base_requests
+	const transport_catalogue::StopDescription stop = ReadStopData(j_dict);
+	// Признак пограничной остановки меняется, только если он указан, как и расстояния:
+	// запрос с одними координатами не сбрасывает остальные данные остановки
+	std::optional<bool> is_boundary;
+	if (j_dict.count("boundary"s) != 0)
+	{
+		is_boundary = stop.is_boundary;
+	}
+	try
+	{
+		tc.UpdateStop(stop.name, stop.coords, is_boundary);
+	}
+	catch (const std::invalid_argument& error)
+	{
+		// Снятие признака пограничной остановки разделило бы сеть неверно
+		return MakeMutationError(j_dict, error.what());
+	}
+
+	const transport_catalogue::StopId stop_id = tc.GetStopByName(stop.name)->id;
+	for (const auto& [to_stop_name, distance] : stop.road_distances)
+	{
+		// Расстояния до отсутствующих в справочнике остановок пропускаются, как и при загрузке
+		if (const transport_catalogue::StopPtr to_stop = tc.GetStopByName(to_stop_name))
+		{
+			tc.SetDistance(stop_id, to_stop->id, distance);
+		}
+	}
+	return MakeMutationAnswer(j_dict, true);
+}
+
+const json::Node ProcessUpdateBusQuery(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
+{
+	// Формат запроса совпадает с описанием маршрута в base_requests
+	const transport_catalogue::RouteDescription route = ReadRouteData(j_dict);
+
+	std::vector<transport_catalogue::StopId> stops;
+	stops.reserve(route.stops.size());
+	for (const std::string_view stop_name : route.stops)
+	{
+		// Несуществующие остановки отбрасываются, как и при загрузке
+		if (const transport_catalogue::StopPtr stop = tc.GetStopByName(stop_name))
+		{
+			stops.push_back(stop->id);
+		}
+	}
+	try
+	{
+		tc.UpdateRoute(route.name, std::move(stops), route.is_circular, route.region);
+	}
+	catch (const std::invalid_argument& error)
+	{
+		// Маршрут другого региона через непограничную остановку
+		return MakeMutationError(j_dict, error.what());
+	}
+	return MakeMutationAnswer(j_dict, true);
+}
+
+const json::Node ProcessRemoveBusQuery(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	return MakeMutationAnswer(j_dict, tc.RemoveRoute(j_dict.at("name"s).AsString()));
+}
+
+const json::Node ProcessSetDistanceQuery(transport_catalogue::TransportCatalogue& tc, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	const transport_catalogue::StopPtr stop_from = tc.GetStopByName(j_dict.at("from"s).AsString());
+	const transport_catalogue::StopPtr stop_to = tc.GetStopByName(j_dict.at("to"s).AsString());
+	if (stop_from == nullptr || stop_to == nullptr)
+	{
+		return MakeMutationAnswer(j_dict, false);
+	}
+	tc.SetDistance(stop_from->id, stop_to->id, static_cast<size_t>(j_dict.at("distance"s).AsInt()));
+	return MakeMutationAnswer(j_dict, true);
+}
+
 const json::Node ProcessStopQuery(transport_catalogue::RequestHandler& rh, const json::Dict& j_dict)
 {
 	using namespace std::literals;
@@ -459,10 +718,53 @@ const json::Node ProcessRouteQuery(router::TransportRouter& tr, const json::Dict
 {
 	using namespace std::literals;
 
-	auto route_data = tr.CalculateRoute(j_dict.at("from").AsString(), j_dict.at("to").AsString());
+	// Необязательное ограничение количества пересадок. Отрицательное - ошибка этого запроса,
+	// остальные запросы пакета обрабатываются
+	std::optional<size_t> max_transfers;
+	if (const auto it = j_dict.find("max_transfers"); it != j_dict.cend())
+	{
+		if (it->second.AsInt() < 0)
+		{
+			return json::Builder{}.StartDict()
+				.Key("request_id").Value(j_dict.at("id").AsInt())
+				.Key("error_message").Value("max_transfers should be non-negative")
+				.EndDict()
+				.Build();
+		}
+		max_transfers = static_cast<size_t>(it->second.AsInt());
+	}
+
+	// Элементы пути сразу превращаются в узлы ответа, минуя промежуточный RouteData
+	json::Array items;
+	const auto total_time = tr.VisitRoute(j_dict.at("from").AsString(), j_dict.at("to").AsString(),
+		[&items](const router::RouteItem& item)
+		{
+			if (item.type == graph::EdgeType::TRAVEL)
+			{
+				items.push_back(json::Builder{}
+								.StartDict()
+								.Key("bus"s).Value(std::string(item.edge_name))
+								.Key("span_count"s).Value(item.span_count)
+								.Key("time"s).Value(item.time)
+								.Key("type"s).Value("Bus"s)
+								.EndDict()
+								.Build());
+			}
+			else
+			{
+				items.push_back(json::Builder{}
+								.StartDict()
+								.Key("stop_name"s).Value(std::string(item.edge_name))
+								.Key("time"s).Value(item.time)
+								.Key("type"s).Value("Wait"s)
+								.EndDict()
+								.Build());
+			}
+		},
+		max_transfers);
 
 	// Подходящий маршрут не найден. Генерируем сообщение об ошибке
-	if (!route_data.founded)
+	if (!total_time)
 	{
 		return json::Builder{}.StartDict()
 			.Key("request_id").Value(j_dict.at("id").AsInt())
@@ -471,33 +773,230 @@ const json::Node ProcessRouteQuery(router::TransportRouter& tr, const json::Dict
 			.Build();
 	}
 
+	return json::Builder{}.StartDict()
+		.Key("request_id").Value(j_dict.at("id").AsInt())
+		.Key("total_time").Value(*total_time)
+		.Key("items").Value(std::move(items))
+		.EndDict()
+		.Build();
+}
+
+
+
+// Ответ со списком остановок рядом с точкой (в порядке возрастания расстояния)
+json::Node MakeNearbyStopsAnswer(const json::Dict& j_dict, const std::vector<transport_catalogue::NearbyStop>& stops)
+{
+	using namespace std::literals;
+
 	json::Array items;
-	// Проходим по элементам маршрута и формируем ответ
-	for (const auto& item : route_data.items)
+	items.reserve(stops.size());
+	for (const auto& stop : stops)
 	{
-		json::Dict items_map;
-		if (item.type == graph::EdgeType::TRAVEL)
-		{
-			items_map["type"] = "Bus"s;
-			items_map["bus"] = item.edge_name;
-			items_map["span_count"] = item.span_count;
-		}
-		else if (item.type == graph::EdgeType::WAIT)
+		items.push_back(json::Builder{}
+						.StartDict()
+						.Key("name"s).Value(std::string(stop.name))
+						.Key("distance"s).Value(stop.distance)
+						.EndDict()
+						.Build());
+	}
+	return json::Builder{}
+		.StartDict()
+		.Key("request_id"s).Value(j_dict.at("id"s).AsInt())
+		.Key("stops"s).Value(items)
+		.EndDict()
+		.Build();
+}
+
+const json::Node ProcessNearestStopsQuery(transport_catalogue::RequestHandler& rh, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	const geo::Coordinates center{ j_dict.at("latitude"s).AsDouble(), j_dict.at("longitude"s).AsDouble() };
+	const int count = j_dict.at("count"s).AsInt();
+	return MakeNearbyStopsAnswer(j_dict, rh.GetNearestStops(center, static_cast<size_t>(std::max(count, 0))));
+}
+
+const json::Node ProcessStopsInRadiusQuery(transport_catalogue::RequestHandler& rh, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	const geo::Coordinates center{ j_dict.at("latitude"s).AsDouble(), j_dict.at("longitude"s).AsDouble() };
+	return MakeNearbyStopsAnswer(j_dict, rh.GetStopsInRadius(center, j_dict.at("radius"s).AsDouble()));
+}
+
+const json::Node ProcessSuggestQuery(transport_catalogue::RequestHandler& rh, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	// Необязательные параметры: количество подсказок (10) и допуск опечаток (1)
+	int count = 10;
+	if (const auto count_it = j_dict.find("count"s); count_it != j_dict.end())
+	{
+		count = count_it->second.AsInt();
+	}
+	int max_edits = 1;
+	if (const auto edits_it = j_dict.find("max_edits"s); edits_it != j_dict.end())
+	{
+		max_edits = edits_it->second.AsInt();
+	}
+
+	const auto suggestions = rh.SuggestNames(j_dict.at("prefix"s).AsString(),
+											 static_cast<size_t>(std::max(count, 0)),
+											 static_cast<uint32_t>(std::max(max_edits, 0)));
+	json::Array items;
+	items.reserve(suggestions.size());
+	for (const auto& suggestion : suggestions)
+	{
+		items.push_back(json::Builder{}
+						.StartDict()
+						.Key("name"s).Value(std::string(suggestion.name))
+						.Key("type"s).Value(suggestion.kind == transport_catalogue::NameKind::STOP ? "Stop"s : "Bus"s)
+						.Key("edits"s).Value(static_cast<int>(suggestion.edits))
+						.EndDict()
+						.Build());
+	}
+	return json::Builder{}
+		.StartDict()
+		.Key("items"s).Value(items)
+		.Key("request_id"s).Value(j_dict.at("id"s).AsInt())
+		.EndDict()
+		.Build();
+}
+
+// Неотрицательная величина (байты, метры). Узел JSON хранит int, большее значение выводится вещественным числом
+json::Node MakeSizeNode(size_t value)
+{
+	if (value <= static_cast<size_t>(std::numeric_limits<int>::max()))
+	{
+		return json::Node(static_cast<int>(value));
+	}
+	return json::Node(static_cast<double>(value));
+}
+
+// Извилистость маршрута нулевой географической длины бесконечна и в JSON выводится как null
+json::Node MakeCurvatureNode(double curvature)
+{
+	if (std::isfinite(curvature))
+	{
+		return json::Node(curvature);
+	}
+	return json::Node(nullptr);
+}
+
+const json::Node ProcessAnalyticsQuery(transport_catalogue::RequestHandler& rh, const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	// Необязательный параметр: количество лучших остановок и маршрутов (10)
+	int count = 10;
+	if (const auto count_it = j_dict.find("count"s); count_it != j_dict.end())
+	{
+		count = count_it->second.AsInt();
+	}
+
+	const transport_catalogue::NetworkAnalytics analytics = rh.GetNetworkAnalytics(static_cast<size_t>(std::max(count, 0)));
+
+	json::Array busiest_stops;
+	busiest_stops.reserve(analytics.busiest_stops.size());
+	for (const auto stat : analytics.busiest_stops)
+	{
+		busiest_stops.push_back(json::Builder{}
+								.StartDict()
+								.Key("name"s).Value(std::string(stat->name))
+								.Key("bus_count"s).Value(static_cast<int>(stat->buses.size()))
+								.EndDict()
+								.Build());
+	}
+	json::Array longest_buses;
+	longest_buses.reserve(analytics.longest_routes.size());
+	for (const auto stat : analytics.longest_routes)
+	{
+		longest_buses.push_back(json::Builder{}
+								.StartDict()
+								.Key("name"s).Value(std::string(stat->name))
+								.Key("route_length"s).Value(static_cast<int>(stat->meters_route_length))
+								.Key("stop_count"s).Value(static_cast<int>(stat->stops_on_route))
+								.Key("curvature"s).Value(MakeCurvatureNode(stat->curvature).GetValue())
+								.EndDict()
+								.Build());
+	}
+	// Распределение пересадочной степени: только встречающиеся количества маршрутов
+	json::Array transfer_degrees;
+	for (size_t degree = 0; degree < analytics.stops_by_degree.size(); ++degree)
+	{
+		if (analytics.stops_by_degree[degree] == 0)
 		{
-			items_map["type"] = "Wait"s;
-			items_map["stop_name"] = item.edge_name;
+			continue;
 		}
-		items_map["time"] = item.time;
-		items.push_back(items_map);
+		transfer_degrees.push_back(json::Builder{}
+								   .StartDict()
+								   .Key("bus_count"s).Value(static_cast<int>(degree))
+								   .Key("stop_count"s).Value(static_cast<int>(analytics.stops_by_degree[degree]))
+								   .EndDict()
+								   .Build());
 	}
-	return json::Builder{}.StartDict()
-		.Key("request_id").Value(j_dict.at("id").AsInt())
-		.Key("total_time").Value(route_data.total_time)
-		.Key("items").Value(items)
+
+	return json::Builder{}
+		.StartDict()
+		.Key("average_curvature"s).Value(analytics.average_curvature)
+		.Key("average_route_length"s).Value(analytics.average_route_length)
+		.Key("average_stop_count"s).Value(analytics.average_stops_on_route)
+		.Key("bus_count"s).Value(static_cast<int>(analytics.routes_count))
+		.Key("busiest_stops"s).Value(busiest_stops)
+		.Key("longest_buses"s).Value(longest_buses)
+		.Key("request_id"s).Value(j_dict.at("id"s).AsInt())
+		.Key("served_stop_count"s).Value(static_cast<int>(analytics.served_stops_count))
+		.Key("stop_count"s).Value(static_cast<int>(analytics.stops_count))
+		.Key("total_route_length"s).Value(MakeSizeNode(static_cast<size_t>(analytics.total_route_length)).GetValue())
+		.Key("transfer_degrees"s).Value(transfer_degrees)
+		.Key("transfer_stop_count"s).Value(static_cast<int>(analytics.transfer_stops_count))
 		.EndDict()
 		.Build();
 }
 
+const json::Node ProcessStatsQuery(const transport_catalogue::TransportCatalogue& tc,
+								   const transport_catalogue::RequestHandler& rh,
+								   router::TransportRouter& tr,
+								   const json::Document& j_doc,
+								   const json::Dict& j_dict)
+{
+	using namespace std::literals;
+
+	const memory_report::MemoryReport report = CollectMemoryReport(tc, rh, tr, j_doc);
 
+	// Подсистемы в порядке первого появления в отчете, структуры - словарем
+	json::Array subsystems;
+	std::vector<std::string_view> listed;
+	for (const auto& item : report.GetItems())
+	{
+		if (std::find(listed.begin(), listed.end(), item.subsystem) != listed.end())
+		{
+			continue;
+		}
+		listed.push_back(item.subsystem);
+		json::Dict structures;
+		for (const auto& structure : report.GetItems())
+		{
+			if (structure.subsystem == item.subsystem)
+			{
+				structures.emplace(structure.structure, MakeSizeNode(structure.bytes));
+			}
+		}
+		subsystems.push_back(json::Builder{}
+							 .StartDict()
+							 .Key("name"s).Value(item.subsystem)
+							 .Key("bytes"s).Value(MakeSizeNode(report.GetSubsystemTotal(item.subsystem)).GetValue())
+							 .Key("structures"s).Value(structures)
+							 .EndDict()
+							 .Build());
+	}
+	return json::Builder{}
+		.StartDict()
+		.Key("request_id"s).Value(j_dict.at("id"s).AsInt())
+		.Key("subsystems"s).Value(subsystems)
+		.Key("total_bytes"s).Value(MakeSizeNode(report.GetTotal()).GetValue())
+		.EndDict()
+		.Build();
+}
 
 }  // namespace json_reader 
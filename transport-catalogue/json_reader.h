@@ -12,14 +12,20 @@
 #pragma once
 
 #include "request_handler.h"        // "Фасад" транспортного каталога
+#include "catalogue_versions.h"
 #include "json_builder.h"
 #include "json.h"
 #include "map_renderer.h"
 #include "transport_router.h"
 #include "serialization.h"
 
+#include <algorithm>                 // для std::count_if
+#include <cmath>                     // для std::isfinite
 #include <iostream>                  // для std::cin (isteam) и std::cout (osteam)
+#include <limits>                    // для предела размера, выводимого целым числом
+#include <memory_resource>           // для арены описаний на этапе загрузки
 #include <sstream>                   // для ostringstream
+#include <stdexcept>                 // для отклоненных изменений каталога
 #include <vector>                    // для вектора этапов обработки входящих данных
 
 namespace json_reader
@@ -27,21 +33,32 @@ namespace json_reader
 
 // ---------------Generic I/O-------------------------
 
-// Обрабатывает все данные формата JSON для режима заполнения базы и сериализации в файл
-void ProcessBaseJSON(transport_catalogue::TransportCatalogue&, map_renderer::MapRenderer&, std::istream&);
-// Обрабатывает все данные формата JSON для режима десериализации и выполнения запросов к базе
-void ProcessRequestJSON(transport_catalogue::TransportCatalogue&, map_renderer::MapRenderer&, std::istream&, std::ostream&);
+// Обрабатывает все данные формата JSON для режима заполнения базы и сериализации в файл.
+// Если задан memory_report_output, выводит в него отчет о памяти подсистем после сериализации
+void ProcessBaseJSON(transport_catalogue::TransportCatalogue&, map_renderer::MapRenderer&, std::istream&,
+					 std::ostream* memory_report_output = nullptr);
+// Обрабатывает все данные формата JSON для режима десериализации и выполнения запросов к базе.
+// Если задан memory_report_output, выводит в него отчет о памяти подсистем после всех запросов.
+// Если задан router_log_output, роутер выводит в него диагностику построения
+void ProcessRequestJSON(transport_catalogue::TransportCatalogue&, map_renderer::MapRenderer&, std::istream&, std::ostream&,
+						std::ostream* memory_report_output = nullptr, std::ostream* router_log_output = nullptr);
+// Собирает отчет о памяти подсистем: каталог, его снимок, рендерер и документ карты, роутер,
+// исходный документ JSON
+memory_report::MemoryReport CollectMemoryReport(const transport_catalogue::TransportCatalogue&,
+												const transport_catalogue::RequestHandler&,
+												router::TransportRouter&, const json::Document&);
 
 //------------Process json input data section-------------------
 
-// Функция добавляет данные в справочник, вызывая специализированные функции для разных типов данных
+// Функция за один проход собирает описания остановок и маршрутов и загружает их в справочник пакетом
 void AddToDB(transport_catalogue::TransportCatalogue&, const json::Array&);
-// Функция добавляет данные об остановке (название, координаты)
-void AddStopData(transport_catalogue::TransportCatalogue&, const json::Dict&);
-// Функция добавляет данные об остановке (расстояния)
-void AddStopDistance(transport_catalogue::TransportCatalogue&, const json::Dict&);
-// Функция добавляет данные о маршруте
-void AddRouteData(transport_catalogue::TransportCatalogue&, const json::Dict&);
+// Функция читает описание остановки (название, координаты, расстояния). Векторы описания
+// выделяются из переданного источника памяти
+transport_catalogue::StopDescription ReadStopData(const json::Dict&,
+	std::pmr::memory_resource* = std::pmr::get_default_resource());
+// Функция читает описание маршрута
+transport_catalogue::RouteDescription ReadRouteData(const json::Dict&,
+	std::pmr::memory_resource* = std::pmr::get_default_resource());
 
 //------------------Process settings-------------------
 
@@ -52,8 +69,25 @@ const std::string ReadSerializationSettings(const json::Dict&);
 
 //--------------Requests section parsing-------------------
 
-// Функция осуществляет разбор секции запросов JSON, назначая соответствующий обработчик
-void ParseRawJSONQueries(transport_catalogue::RequestHandler&, router::TransportRouter&, const json::Array&, std::ostream&);
+// Функция осуществляет разбор секции запросов JSON, назначая соответствующий обработчик.
+// Запросы изменения применяются к каталогу, новая версия (и ссылки на нее у обработчика
+// и роутера) публикуется перед первым после изменений запросом чтения
+void ParseRawJSONQueries(transport_catalogue::TransportCatalogue&,
+						 transport_catalogue::CatalogueVersions&, transport_catalogue::FrozenCataloguePtr&,
+						 transport_catalogue::RequestHandler&, router::TransportRouter&,
+						 const json::Document&, const json::Array&, std::ostream&);
+// Функция публикует новую версию каталога, если с прошлой версии каталог изменялся,
+// и переключает на нее обработчик запросов и роутер
+void RefreshSnapshot(transport_catalogue::CatalogueVersions&, transport_catalogue::FrozenCataloguePtr&,
+					 transport_catalogue::RequestHandler&, router::TransportRouter&);
+// Функция обрабатывает запросы типа "UpdateStop" (добавление остановки или изменение координат)
+const json::Node ProcessUpdateStopQuery(transport_catalogue::TransportCatalogue&, const json::Dict&);
+// Функция обрабатывает запросы типа "UpdateBus" (добавление или замена маршрута)
+const json::Node ProcessUpdateBusQuery(transport_catalogue::TransportCatalogue&, const json::Dict&);
+// Функция обрабатывает запросы типа "RemoveBus" (удаление маршрута)
+const json::Node ProcessRemoveBusQuery(transport_catalogue::TransportCatalogue&, const json::Dict&);
+// Функция обрабатывает запросы типа "SetDistance" (расстояние между остановками)
+const json::Node ProcessSetDistanceQuery(transport_catalogue::TransportCatalogue&, const json::Dict&);
 // Функция обрабатывает запросы типа "Stop" (маршруты через остановку)
 const json::Node ProcessStopQuery(transport_catalogue::RequestHandler&, const json::Dict&);
 // Функция обрабатывает запросы типа "Bus"
@@ -62,4 +96,15 @@ const json::Node ProcessBusQuery(transport_catalogue::RequestHandler&, const jso
 const json::Node ProcessMapQuery(transport_catalogue::RequestHandler&, const json::Dict&);
 // Функция обрабатывает запросы типа "Route" (построение маршрута между произвольными остановками)
 const json::Node ProcessRouteQuery(router::TransportRouter&, const json::Dict&);
+// Функция обрабатывает запросы типа "NearestStops" (k ближайших к точке остановок)
+const json::Node ProcessNearestStopsQuery(transport_catalogue::RequestHandler&, const json::Dict&);
+// Функция обрабатывает запросы типа "StopsInRadius" (остановки в радиусе от точки)
+const json::Node ProcessStopsInRadiusQuery(transport_catalogue::RequestHandler&, const json::Dict&);
+// Функция обрабатывает запросы типа "Suggest" (подсказки названий по началу строки)
+const json::Node ProcessSuggestQuery(transport_catalogue::RequestHandler&, const json::Dict&);
+// Функция обрабатывает запросы типа "Analytics" (показатели всей сети)
+const json::Node ProcessAnalyticsQuery(transport_catalogue::RequestHandler&, const json::Dict&);
+// Функция обрабатывает запросы типа "Stats" (память подсистем по структурам)
+const json::Node ProcessStatsQuery(const transport_catalogue::TransportCatalogue&, const transport_catalogue::RequestHandler&,
+								   router::TransportRouter&, const json::Document&, const json::Dict&);
 }
@@ -5,6 +5,7 @@
 
 #include <iostream>             // для std::cin (isteam) и std::cout (osteam)
 #include <fstream>              // для сериализации в файл
+#include <stdexcept>            // для ошибок во входных данных
 #include <string_view>
 
 // Для отладки установить настройку в IDE
@@ -36,13 +37,13 @@ int main()
 
 void PrintUsage(std::ostream& stream = std::cerr)
 {
-    stream << "Usage: transport_catalogue [make_base|process_requests]\n"sv;
+    stream << "Usage: transport_catalogue [make_base|process_requests] [--memory-report] [--router-log]\n"sv;
 }
 
 // НОВЫЙ main()
 int main(int argc, char* argv[])
 {
-    if (argc != 2)
+    if (argc < 2 || argc > 4)
     {
         PrintUsage();
         return 1;
@@ -50,14 +51,45 @@ int main(int argc, char* argv[])
 
     const std::string_view mode(argv[1]);
 
+    // Отчет о памяти подсистем и диагностика роутера выводятся в stderr, чтобы не смешиваться
+    // с ответами в stdout
+    std::ostream* memory_report_output = nullptr;
+    std::ostream* router_log_output = nullptr;
+    for (int i = 2; i < argc; ++i)
+    {
+        const std::string_view option(argv[i]);
+        if (option == "--memory-report"sv)
+        {
+            memory_report_output = &std::cerr;
+        }
+        else if (option == "--router-log"sv)
+        {
+            router_log_output = &std::cerr;
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
     if (mode == "make_base"sv)
     {
         // Создаем справочник
         transport_catalogue::TransportCatalogue tc;
         // Создаем рендерер карт
         map_renderer::MapRenderer mr;
-        // Вызываем JSON обработчик запросов "make_base" с требуемыми параметрами-ссылками
-        json_reader::ProcessBaseJSON(tc, mr, std::cin);
+        // Вызываем JSON обработчик запросов "make_base" с требуемыми параметрами-ссылками.
+        // Неверная база (например, непограничная остановка нескольких регионов) не сохраняется
+        try
+        {
+            json_reader::ProcessBaseJSON(tc, mr, std::cin, memory_report_output);
+        }
+        catch (const std::invalid_argument& error)
+        {
+            std::cerr << "make_base: "sv << error.what() << '\n';
+            return 1;
+        }
     }
     else if (mode == "process_requests"sv)
     {
@@ -66,7 +98,7 @@ int main(int argc, char* argv[])
         // Создаем рендерер карт
         map_renderer::MapRenderer mr;
         // Вызываем JSON обработчик запросов "process_requests" с требуемыми параметрами-ссылками
-        json_reader::ProcessRequestJSON(tc, mr, std::cin, std::cout);
+        json_reader::ProcessRequestJSON(tc, mr, std::cin, std::cout, memory_report_output, router_log_output);
     }
     else
     {
@@ -130,14 +130,15 @@ RendererSettings MapRenderer::GetRendererSettings() const
 
 void MapRenderer::AddRouteLinesToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
 										SphereProjector& sp,
-										std::map<const std::string, transport_catalogue::RendererData>& routes_to_render)
+										const transport_catalogue::RendererData& map_data)
 {
-	for (const auto& [name, data] : routes_to_render)
+	for (const auto& route : map_data.routes)
 	{
 		std::vector<svg::Point> points;  // Вектор нормализованных координат
-		for (const auto& stop : data.stop_coords)
+		points.reserve(route.stops.size());
+		for (const transport_catalogue::StopId stop_id : route.stops)
 		{
-			points.push_back(sp(stop));
+			points.push_back(sp(map_data.coords_by_id->Get(stop_id)));
 		}
 		// формируем unique_ptr
 		picture_.emplace_back(std::make_unique<RouteLine>(RouteLine{ points, GetColorFromPallete() , settings_ }));
@@ -148,29 +149,31 @@ void MapRenderer::AddRouteLinesToRender(std::vector<std::unique_ptr<svg::Drawabl
 
 void MapRenderer::AddRouteLabelsToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
 										 SphereProjector& sp,
-										 std::map<const std::string, transport_catalogue::RendererData>& routes_to_render)
+										 const transport_catalogue::RendererData& map_data)
 {
 	ResetPallette();  // Сбрасываем текущий цвет палитры, начинаем с первого
-	for (const auto& [name, data] : routes_to_render)
+	for (const auto& route : map_data.routes)
 	{
+		const geo::Coordinates first_stop = map_data.coords_by_id->Get(route.stops[0]);
 		// Получаем цвет текущего маршрута
 		svg::Color current_line_color = GetColorFromPallete();
 		// Выводим первую метку маршрута (стартовую)
-		picture_.emplace_back(std::make_unique<TextLabel>(TextLabel{ sp(data.stop_coords[0]),
-														  name,
+		picture_.emplace_back(std::make_unique<TextLabel>(TextLabel{ sp(first_stop),
+														  std::string(route.name),
 														  current_line_color,
 														  settings_,
 														  false }));
 		// Если маршрут НЕ кольцевой и у него больше 1 остановки, выводим метку конечной остановки
-		if ((!data.is_circular) && (data.stop_coords.size() > 1))
+		if ((!route.is_circular) && (route.stops.size() > 1))
 		{
-			// Учитываем, что для некольцевых маршрутов координаты хранятся туда и обратно (А,В,А) и всегда нечетны
+			// Для некольцевых маршрутов обход идет туда и обратно (А,В,А) и всегда нечетен
 			// Выводим, если начальная и конечная точки не совпадают А <> В
-			if (data.stop_coords[0] != data.stop_coords[(data.stop_coords.size() + 1) / 2 - 1])
+			const geo::Coordinates last_stop = map_data.coords_by_id->Get(route.stops[(route.stops.size() + 1) / 2 - 1]);
+			if (first_stop != last_stop)
 			{
 				// Выводим вторую метку маршрута (конечную)
-				picture_.emplace_back(std::make_unique<TextLabel>(TextLabel{ sp(data.stop_coords[(data.stop_coords.size() + 1) / 2 - 1]),
-																  name,
+				picture_.emplace_back(std::make_unique<TextLabel>(TextLabel{ sp(last_stop),
+																  std::string(route.name),
 																  current_line_color,
 																  settings_,
 																  false }));
@@ -182,27 +185,27 @@ void MapRenderer::AddRouteLabelsToRender(std::vector<std::unique_ptr<svg::Drawab
 
 void MapRenderer::AddStopLabelsToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
 										SphereProjector& sp,
-										std::map<std::string_view, geo::Coordinates> all_unique_stops)
+										const transport_catalogue::RendererData& map_data)
 {
-	for (const auto& stop : all_unique_stops)
+	for (const auto& coords : map_data.stop_coords)
 	{
 		// формируем unique_ptr
-		picture_.emplace_back(std::make_unique<StopIcon>(StopIcon{ sp(stop.second), settings_ }));
+		picture_.emplace_back(std::make_unique<StopIcon>(StopIcon{ sp(coords), settings_ }));
 	}
 }
 
 
 void MapRenderer::AddStopIconsToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
 									   SphereProjector& sp,
-									   std::map<std::string_view, geo::Coordinates> all_unique_stops)
+									   const transport_catalogue::RendererData& map_data)
 {
 	using namespace std::literals;
 
-	for (const auto& stop : all_unique_stops)
+	for (size_t i = 0; i < map_data.stop_names.size(); ++i)
 	{
 		// формируем unique_ptr
-		picture_.emplace_back(std::make_unique<TextLabel>(TextLabel{ sp(stop.second),
-														  std::string(stop.first),
+		picture_.emplace_back(std::make_unique<TextLabel>(TextLabel{ sp(map_data.stop_coords[i]),
+														  std::string(map_data.stop_names[i]),
 														  "black"s,
 														  settings_,
 														  true }));
@@ -210,35 +213,24 @@ void MapRenderer::AddStopIconsToRender(std::vector<std::unique_ptr<svg::Drawable
 }
 
 
-svg::Document MapRenderer::RenderMap(std::map<const std::string, transport_catalogue::RendererData>& routes_to_render)
+svg::Document MapRenderer::RenderMap(const transport_catalogue::RendererData& map_data)
 {
-	std::unordered_set<geo::Coordinates, geo::CoordinatesHasher> all_coords;    // Кэш координат для калибровки
-	std::map<std::string_view, geo::Coordinates> all_unique_stops;              // Кэш уникальных остановок (сортировка по имени)
-
-	// 1. Нормализуем координаты для переданных в рендерер точек (только непустые маршруты)
-	for (const auto& [name, data] : routes_to_render)
-	{
-		for (size_t i = 0; i < data.stop_coords.size(); ++i)
-		{
-			all_coords.insert(data.stop_coords[i]);
-			all_unique_stops.insert(make_pair(data.stop_names[i], data.stop_coords[i]));
-		}
-	}
-	// Пропускаем через проектор ВСЕ координаты и получаем поправочный коэффициент
-	SphereProjector sp{ std::begin(all_coords), std::end(all_coords),
+	// 1. Нормализуем координаты для переданных в рендерер точек. Остановки непустых маршрутов
+	// каталог уже собрал без повторов - пропускаем их через проектор и получаем поправочный коэффициент
+	SphereProjector sp{ map_data.stop_coords.begin(), map_data.stop_coords.end(),
 		settings_.width, settings_.height, settings_.padding };
 
 	// 2. Добавляем в контейнер Drawable-объекты, используя нормализованные координаты
 	std::vector<std::unique_ptr<svg::Drawable>> picture_;   // Контейнер Drawable-объектов
 	// 2.1 Линии маршрутов
-	AddRouteLinesToRender(picture_, sp, routes_to_render);
+	AddRouteLinesToRender(picture_, sp, map_data);
 	// 2.2 Метки маршрутов
-	AddRouteLabelsToRender(picture_, sp, routes_to_render);
+	AddRouteLabelsToRender(picture_, sp, map_data);
 	// 2.3 Метки остановок (только те, через которые проходят маршруты)
 	//      (очередность - лексикографическое возрастание)
-	AddStopLabelsToRender(picture_, sp, all_unique_stops);
+	AddStopLabelsToRender(picture_, sp, map_data);
 	// 2.4 Метки остановок (очередность - лексикографическое возрастание)
-	AddStopIconsToRender(picture_, sp, all_unique_stops);
+	AddStopIconsToRender(picture_, sp, map_data);
 
 	// 3. Вызываем Draw() по очереди для всех элеметов контейнера, формируя svg::Document
 	//    из svg-примитивов
@@ -250,6 +242,22 @@ svg::Document MapRenderer::RenderMap(std::map<const std::string, transport_catal
 	return map;  // Document.Render() будет вызывать уже метод-получатель
 }
 
+void MapRenderer::ReportMemory(memory_report::MemoryReport& report) const
+{
+	// Память цвета в куче - только у цвета, заданного названием
+	auto color_bytes = [](const svg::Color& color)
+	{
+		const std::string* name = std::get_if<std::string>(&color);
+		return name ? memory_report::StringBytes(*name) : 0;
+	};
+	size_t bytes = memory_report::VectorBytes(settings_.color_palette) + color_bytes(settings_.underlayer_color);
+	for (const auto& color : settings_.color_palette)
+	{
+		bytes += color_bytes(color);
+	}
+	report.Add("MapRenderer", "settings", bytes);
+}
+
 const svg::Color MapRenderer::GetColorFromPallete()
 {
 	if (pallette_item_ == settings_.color_palette.size())
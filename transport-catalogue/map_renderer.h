@@ -12,9 +12,6 @@
 #include <string_view>
 #include <vector>
 #include <cmath>
-#include <map>            // для входящих данных маршрутов
-#include <unordered_set>  // для временного набора координат
-//#include <unordered_map>  // альтенатива для временного набора координат
 #include <algorithm>      // для std::minmax_element
 #include <memory>         // для unique_ptr
 
@@ -179,23 +176,26 @@ public:
     // Метод добавляет данные линий маршрутов в SVG-файл
     void AddRouteLinesToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
                                SphereProjector& sp,
-                               std::map<const std::string, transport_catalogue::RendererData>& routes_to_render);
+                               const transport_catalogue::RendererData& map_data);
     // Метод добавляет названия маршрутов в SVG-файл
     void AddRouteLabelsToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
                                 SphereProjector& sp,
-                                std::map<const std::string, transport_catalogue::RendererData>& routes_to_render);
+                                const transport_catalogue::RendererData& map_data);
     // Метод добавляет названия остановок в SVG-файл
     void AddStopLabelsToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
                                SphereProjector& sp,
-                               std::map<std::string_view, geo::Coordinates> all_unique_stops);
+                               const transport_catalogue::RendererData& map_data);
     // Метод добавляет метки остановок в SVG-файл
     void AddStopIconsToRender(std::vector<std::unique_ptr<svg::Drawable>>& picture_,
                               SphereProjector& sp,
-                              std::map<std::string_view, geo::Coordinates> all_unique_stops);
+                              const transport_catalogue::RendererData& map_data);
 
     // Метод формирует итоговый SVG-файл, вызывая методы рендера всех составных частей документа
-    svg::Document RenderMap(std::map<const std::string, transport_catalogue::RendererData>&);
+    svg::Document RenderMap(const transport_catalogue::RendererData&);
 
+    // Добавляет в отчет память настроек рендерера (документ карты строится на каждый
+    // запрос и учитывается отдельно, см. svg::Document::ReportMemory)
+    void ReportMemory(memory_report::MemoryReport&) const;
 
     // Производит отрисовку всех Drawable объектов в контейнере по итераторам
     template <typename DrawableIterator>
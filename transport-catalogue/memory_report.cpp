@@ -0,0 +1,91 @@
+#include "memory_report.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace memory_report
+{
+
+namespace
+{
+
+const int NAME_WIDTH = 40;
+const int BYTES_WIDTH = 16;
+
+} // namespace
+
+// ----------- MemoryReport ---------------
+
+void MemoryReport::Add(std::string_view subsystem, std::string_view structure, size_t bytes)
+{
+	// Поиск с конца: подсистема обычно добавляет свои структуры подряд
+	const auto it = std::find_if(items_.rbegin(), items_.rend(), [subsystem, structure](const MemoryItem& item)
+		{
+			return item.subsystem == subsystem && item.structure == structure;
+		});
+	if (it != items_.rend())
+	{
+		it->bytes += bytes;
+		return;
+	}
+	items_.push_back({ std::string(subsystem), std::string(structure), bytes });
+}
+
+
+const std::vector<MemoryItem>& MemoryReport::GetItems() const
+{
+	return items_;
+}
+
+
+size_t MemoryReport::GetSubsystemTotal(std::string_view subsystem) const
+{
+	size_t total = 0;
+	for (const auto& item : items_)
+	{
+		if (item.subsystem == subsystem)
+		{
+			total += item.bytes;
+		}
+	}
+	return total;
+}
+
+
+size_t MemoryReport::GetTotal() const
+{
+	size_t total = 0;
+	for (const auto& item : items_)
+	{
+		total += item.bytes;
+	}
+	return total;
+}
+
+
+void MemoryReport::Print(std::ostream& output) const
+{
+	output << std::left << std::setw(NAME_WIDTH) << "Memory report" << std::right << std::setw(BYTES_WIDTH) << "bytes" << '\n';
+	std::vector<std::string_view> printed;
+	for (const auto& item : items_)
+	{
+		if (std::find(printed.begin(), printed.end(), item.subsystem) != printed.end())
+		{
+			continue;
+		}
+		printed.push_back(item.subsystem);
+		output << std::left << std::setw(NAME_WIDTH) << item.subsystem
+			<< std::right << std::setw(BYTES_WIDTH) << GetSubsystemTotal(item.subsystem) << '\n';
+		for (const auto& structure : items_)
+		{
+			if (structure.subsystem == item.subsystem)
+			{
+				output << "    " << std::left << std::setw(NAME_WIDTH - 4) << structure.structure
+					<< std::right << std::setw(BYTES_WIDTH) << structure.bytes << '\n';
+			}
+		}
+	}
+	output << std::left << std::setw(NAME_WIDTH) << "Total" << std::right << std::setw(BYTES_WIDTH) << GetTotal() << '\n';
+}
+
+}
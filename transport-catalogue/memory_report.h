@@ -0,0 +1,110 @@
+/*
+ * Назначение модуля: учет памяти, занимаемой структурами данных подсистем.
+ *
+ * Каждая подсистема (каталог, снимок каталога, граф, роутеры, рендерер, документы JSON и SVG)
+ * добавляет в MemoryReport байты по своим структурам. Считается динамическая память,
+ * которой владеют контейнеры, - по емкости, а не по размеру. Для узловых контейнеров
+ * стандартной библиотеки размер узла оценивается по устройству libstdc++ (без учета
+ * служебных данных распределителя), поэтому отчет - оценка, пригодная для сравнения
+ * версий и выбора параметров, а не точное значение RSS процесса.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace memory_report
+{
+
+// Строка отчета: структура подсистемы и занимаемая ей память
+struct MemoryItem
+{
+	std::string subsystem;
+	std::string structure;
+	size_t bytes = 0;
+};
+
+// ----------- MemoryReport ---------------
+
+class MemoryReport
+{
+public:
+	// Добавляет байты структуре подсистемы. Повторные добавления той же структуры суммируются
+	void Add(std::string_view subsystem, std::string_view structure, size_t bytes);
+
+	// Строки в порядке первого добавления (структуры подсистемы идут подряд, если подсистема
+	// добавляет их без перерыва)
+	const std::vector<MemoryItem>& GetItems() const;
+	size_t GetSubsystemTotal(std::string_view subsystem) const;
+	size_t GetTotal() const;
+
+	// Выводит отчет таблицей: подсистема с итогом, под ней ее структуры
+	void Print(std::ostream&) const;
+
+private:
+	std::vector<MemoryItem> items_;
+};
+
+// ----------- Оценки памяти контейнеров ---------------
+// Возвращают динамическую память контейнера (sizeof самого контейнера учитывает владелец).
+// Для контейнеров std::pmr - память, запрошенная у их источника памяти
+
+template <typename T, typename Allocator>
+size_t VectorBytes(const std::vector<T, Allocator>& container)
+{
+	return container.capacity() * sizeof(T);
+}
+
+// Вектор векторов: внешний массив и массивы всех элементов
+template <typename T, typename Allocator, typename OuterAllocator>
+size_t NestedVectorBytes(const std::vector<std::vector<T, Allocator>, OuterAllocator>& container)
+{
+	size_t bytes = VectorBytes(container);
+	for (const auto& item : container)
+	{
+		bytes += VectorBytes(item);
+	}
+	return bytes;
+}
+
+// Строка: буфер в куче, если строка не поместилась во внутренний буфер объекта
+inline size_t StringBytes(const std::string& str)
+{
+	return (str.capacity() > std::string().capacity()) ? str.capacity() + 1 : 0;
+}
+
+// Дек: блоки по 512 байт (или по одному элементу, если он больше) и массив указателей на блоки
+template <typename T, typename Allocator>
+size_t DequeBytes(const std::deque<T, Allocator>& container)
+{
+	constexpr size_t BLOCK_BYTES = 512;
+	constexpr size_t ITEMS_PER_BLOCK = (sizeof(T) < BLOCK_BYTES) ? BLOCK_BYTES / sizeof(T) : 1;
+	const size_t blocks = container.size() / ITEMS_PER_BLOCK + 1;
+	const size_t map_size = std::max<size_t>(8, blocks + 2);
+	return blocks * ITEMS_PER_BLOCK * sizeof(T) + map_size * sizeof(void*);
+}
+
+// Хэш-таблица: массив корзин и узлы (указатель на следующий, значение, сохраненный хэш)
+template <typename HashTable>
+size_t HashTableBytes(const HashTable& container)
+{
+	using Value = typename HashTable::value_type;
+	return container.bucket_count() * sizeof(void*)
+		+ container.size() * (sizeof(void*) + sizeof(Value) + sizeof(size_t));
+}
+
+// Красно-черное дерево: узлы (цвет и три указателя, значение)
+template <typename Tree>
+size_t TreeBytes(const Tree& container)
+{
+	using Value = typename Tree::value_type;
+	return container.size() * (4 * sizeof(void*) + sizeof(Value));
+}
+
+}
@@ -0,0 +1,277 @@
+#include "name_suggest.h"
+#include "memory_report.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace transport_catalogue
+{
+
+namespace
+{
+
+// Нижний регистр для латиницы и кириллицы, "ё" -> "е"
+char32_t FoldChar(char32_t c)
+{
+	if (c >= U'A' && c <= U'Z')
+	{
+		return c + (U'a' - U'A');
+	}
+	if (c >= 0x410 && c <= 0x42F)           // А..Я
+	{
+		c += 0x20;
+	}
+	else if (c >= 0x400 && c <= 0x40F)      // Ѐ..Џ (в том числе Ё)
+	{
+		c += 0x50;
+	}
+	return (c == 0x451) ? 0x435 : c;        // ё -> е
+}
+
+bool IsContinuation(unsigned char byte)
+{
+	return (byte & 0xC0) == 0x80;
+}
+
+} // namespace
+
+// ----------- NameSuggestIndex ---------------
+
+std::u32string NameSuggestIndex::Fold(std::string_view text)
+{
+	std::u32string result;
+	result.reserve(text.size());
+	size_t pos = 0;
+	while (pos < text.size())
+	{
+		const unsigned char lead = static_cast<unsigned char>(text[pos]);
+		size_t length = 1;
+		char32_t code = lead;
+		if ((lead >> 5) == 0x6)
+		{
+			length = 2;
+			code = lead & 0x1F;
+		}
+		else if ((lead >> 4) == 0xE)
+		{
+			length = 3;
+			code = lead & 0x0F;
+		}
+		else if ((lead >> 3) == 0x1E)
+		{
+			length = 4;
+			code = lead & 0x07;
+		}
+
+		bool valid = (length == 1) || (pos + length <= text.size());
+		for (size_t i = 1; valid && i < length; ++i)
+		{
+			const unsigned char byte = static_cast<unsigned char>(text[pos + i]);
+			valid = IsContinuation(byte);
+			code = (code << 6) | (byte & 0x3F);
+		}
+		if (!valid)
+		{
+			// Неверная последовательность: байт становится отдельным символом
+			length = 1;
+			code = lead;
+		}
+		result.push_back(FoldChar(code));
+		pos += length;
+	}
+	return result;
+}
+
+
+NameSuggestIndex::NameSuggestIndex(const std::vector<std::string_view>& stop_names,
+								   const std::vector<std::string_view>& route_names)
+{
+	// 1. Приведенные названия в алфавитном порядке. Короткое название идет раньше своих продолжений
+	std::vector<std::pair<std::u32string, NameMatch>> keys;
+	keys.reserve(stop_names.size() + route_names.size());
+	for (uint32_t id = 0; id < stop_names.size(); ++id)
+	{
+		keys.emplace_back(Fold(stop_names[id]), NameMatch{ NameKind::STOP, id, 0 });
+	}
+	for (uint32_t id = 0; id < route_names.size(); ++id)
+	{
+		keys.emplace_back(Fold(route_names[id]), NameMatch{ NameKind::ROUTE, id, 0 });
+	}
+	std::sort(keys.begin(), keys.end(), [](const auto& lhs, const auto& rhs)
+			  {
+				  if (lhs.first != rhs.first)
+				  {
+					  return lhs.first < rhs.first;
+				  }
+				  return std::make_pair(lhs.second.kind, lhs.second.id) < std::make_pair(rhs.second.kind, rhs.second.id);
+			  });
+	entries_.reserve(keys.size());
+	for (const auto& key : keys)
+	{
+		entries_.push_back(key.second);
+	}
+
+	// 2. Дерево строится по уровням: дети каждого узла добавляются подряд
+	nodes_.push_back(Node{ 0, 0, 0, 0, static_cast<uint32_t>(keys.size()) });
+	std::vector<std::pair<uint32_t, size_t>> queue{ { 0U, size_t{ 0 } } };    // Узел и его глубина
+	for (size_t next = 0; next < queue.size(); ++next)
+	{
+		const auto [node, depth] = queue[next];
+		uint32_t begin = nodes_[node].begin;
+		const uint32_t end = nodes_[node].end;
+		// Названия, которые заканчиваются в этом узле, стоят в начале его отрезка
+		while (begin < end && keys[begin].first.size() == depth)
+		{
+			++begin;
+		}
+		nodes_[node].first_child = static_cast<uint32_t>(nodes_.size());
+		while (begin < end)
+		{
+			const char32_t label = keys[begin].first[depth];
+			uint32_t run_end = begin + 1;
+			while (run_end < end && keys[run_end].first[depth] == label)
+			{
+				++run_end;
+			}
+			queue.emplace_back(static_cast<uint32_t>(nodes_.size()), depth + 1);
+			nodes_.push_back(Node{ label, 0, 0, begin, run_end });
+			begin = run_end;
+		}
+		nodes_[node].children_count = static_cast<uint32_t>(nodes_.size()) - nodes_[node].first_child;
+	}
+}
+
+
+uint32_t NameSuggestIndex::GetPrefixDistance(const std::u32string& folded_query, std::string_view name, uint32_t limit)
+{
+	// Та же таблица расстояний, что при обходе дерева, по пути из одного названия
+	std::vector<uint32_t> row(folded_query.size() + 1);
+	std::vector<uint32_t> next_row(folded_query.size() + 1);
+	for (size_t j = 0; j < row.size(); ++j)
+	{
+		row[j] = static_cast<uint32_t>(j);
+	}
+	uint32_t best = row.back();
+	for (const char32_t label : Fold(name))
+	{
+		if (best == 0 || *std::min_element(row.begin(), row.end()) > limit)
+		{
+			break;
+		}
+		next_row[0] = row[0] + 1;
+		for (size_t j = 1; j < row.size(); ++j)
+		{
+			const uint32_t replace = row[j - 1] + (folded_query[j - 1] == label ? 0 : 1);
+			next_row[j] = std::min({ row[j] + 1, next_row[j - 1] + 1, replace });
+		}
+		row.swap(next_row);
+		best = std::min(best, row.back());
+	}
+	return std::min(best, limit + 1);
+}
+
+
+size_t NameSuggestIndex::GetMemoryUsage() const
+{
+	return memory_report::VectorBytes(nodes_) + memory_report::VectorBytes(entries_);
+}
+
+
+bool NameSuggestIndex::Emit(uint32_t begin, uint32_t end, SearchState& state) const
+{
+	// Узлы подходят в порядке обхода, то есть по возрастанию начала отрезка. Вложенные
+	// отрезки уже просмотрены вместе с объемлющим
+	for (uint32_t pos = std::max(begin, state.covered); pos < end; ++pos)
+	{
+		if (state.result.size() == state.count)
+		{
+			return false;
+		}
+		// Названия с меньшим количеством исправлений выданы на прошлых уровнях
+		if (!state.emitted.insert(pos).second)
+		{
+			continue;
+		}
+		NameMatch match = entries_[pos];
+		match.edits = state.edits;
+		state.result.push_back(match);
+	}
+	state.covered = std::max(state.covered, end);
+	return state.result.size() < state.count;
+}
+
+
+bool NameSuggestIndex::Search(uint32_t node, size_t depth, const std::u32string& query,
+							  std::vector<std::vector<uint32_t>>& rows, SearchState& state) const
+{
+	// rows[depth][j] - расстояние между началом запроса длины j и строкой пути к узлу
+	const std::vector<uint32_t>& row = rows[depth];
+	const uint32_t row_min = *std::min_element(row.begin(), row.end());
+	if (row.back() <= state.edits)
+	{
+		if (!Emit(nodes_[node].begin, nodes_[node].end, state))
+		{
+			return false;
+		}
+		if (row.back() == row_min)
+		{
+			// Ниже по дереву расстояние до запроса не станет меньше - поддерево уже учтено целиком
+			return true;
+		}
+	}
+	if (row_min > state.edits)
+	{
+		return true;
+	}
+
+	std::vector<uint32_t>& next_row = rows[depth + 1];
+	const Node& parent = nodes_[node];
+	for (uint32_t child = parent.first_child; child < parent.first_child + parent.children_count; ++child)
+	{
+		const char32_t label = nodes_[child].label;
+		next_row[0] = row[0] + 1;
+		for (size_t j = 1; j < row.size(); ++j)
+		{
+			const uint32_t replace = row[j - 1] + (query[j - 1] == label ? 0 : 1);
+			next_row[j] = std::min({ row[j] + 1, next_row[j - 1] + 1, replace });
+		}
+		if (!Search(child, depth + 1, query, rows, state))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+std::vector<NameMatch> NameSuggestIndex::Suggest(std::string_view query, size_t count, uint32_t max_edits) const
+{
+	if (count == 0 || nodes_.empty())
+	{
+		return {};
+	}
+	max_edits = std::min(max_edits, MAX_EDITS);
+	const std::u32string folded = Fold(query);
+
+	// Глубже |query| + max_edits + 1 обход не спускается: там вся строка таблицы больше допуска
+	std::vector<std::vector<uint32_t>> rows(folded.size() + max_edits + 2, std::vector<uint32_t>(folded.size() + 1));
+	for (size_t j = 0; j <= folded.size(); ++j)
+	{
+		rows[0][j] = static_cast<uint32_t>(j);
+	}
+
+	// Уровень допуска e выдает названия ровно с e исправлениями: меньшие уже выданы целиком
+	SearchState state;
+	state.count = count;
+	// Выдается не больше count названий: таблица не перестраивается, а проверка - O(1)
+	state.emitted.reserve(std::min(count, entries_.size()));
+	for (uint32_t edits = 0; edits <= max_edits && state.result.size() < count; ++edits)
+	{
+		state.edits = edits;
+		state.covered = 0;
+		Search(0, 0, folded, rows, state);
+	}
+	return std::move(state.result);
+}
+
+}
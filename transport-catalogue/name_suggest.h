@@ -0,0 +1,101 @@
+/*
+ * Назначение модуля: подсказки названий остановок и маршрутов по началу строки (автодополнение)
+ * с допуском опечаток.
+ *
+ * Названия разбираются как UTF-8 и приводятся к нижнему регистру (латиница и кириллица,
+ * "ё" приравнивается к "е"). Приведенные названия хранятся в префиксном дереве: дети узла
+ * лежат подряд, а названия с общим началом - непрерывным отрезком в отсортированном
+ * массиве, поэтому любые k названий поддерева берутся без обхода поддерева.
+ *
+ * Нечеткий поиск - обход дерева со строкой таблицы расстояний Левенштейна между запросом
+ * и началом названия. Узел подходит, если расстояние до всего запроса не больше допуска,
+ * и тогда подходят все названия его поддерева. Спуск прекращается, как только минимум
+ * строки таблицы превысил допуск: ниже по дереву он не уменьшается. Допуск наращивается
+ * от 0: обход идет в алфавитном порядке и останавливается, набрав нужное количество
+ * названий, поэтому затраты определяются размером ответа, а не размером словаря.
+ */
+
+#pragma once
+
+#include "domain.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace transport_catalogue
+{
+
+// Вид названия в индексе подсказок
+enum class NameKind : uint8_t
+{
+	STOP,
+	ROUTE,
+};
+
+// Найденное название: вид, номер остановки / маршрута и количество исправлений запроса
+struct NameMatch
+{
+	NameKind kind = NameKind::STOP;
+	uint32_t id = 0;
+	uint32_t edits = 0;
+};
+
+// ----------- NameSuggestIndex ---------------
+
+class NameSuggestIndex
+{
+public:
+	// Наибольший допуск опечаток. С большим допуском короткий запрос подходит почти ко всему
+	static constexpr uint32_t MAX_EDITS = 2;
+
+	NameSuggestIndex() = default;
+	// Строит индекс по названиям остановок и маршрутов (номер названия - позиция в векторе)
+	NameSuggestIndex(const std::vector<std::string_view>& stop_names, const std::vector<std::string_view>& route_names);
+
+	// Не более count названий, начало которых отличается от query не более чем на max_edits
+	// исправлений. Порядок: по количеству исправлений, затем по алфавиту приведенных названий
+	std::vector<NameMatch> Suggest(std::string_view query, size_t count, uint32_t max_edits) const;
+
+	// Динамическая память дерева и списка названий, байт
+	size_t GetMemoryUsage() const;
+
+	// Приводит строку UTF-8 к виду, в котором хранятся названия
+	static std::u32string Fold(std::string_view text);
+	// Количество исправлений, с которым Suggest нашел бы название по приведенному запросу:
+	// наименьшее расстояние от запроса до начала названия. Если оно больше limit, возвращает limit + 1
+	static uint32_t GetPrefixDistance(const std::u32string& folded_query, std::string_view name, uint32_t limit);
+
+private:
+	struct Node
+	{
+		char32_t label = 0;            // Символ на ребре от родителя
+		uint32_t first_child = 0;      // Дети узла - [first_child, first_child + children_count)
+		uint32_t children_count = 0;
+		uint32_t begin = 0;            // Названия поддерева - [begin, end) в entries_
+		uint32_t end = 0;
+	};
+	// Состояние поиска на одном уровне допуска
+	struct SearchState
+	{
+		uint32_t edits = 0;                        // Текущий допуск
+		size_t count = 0;                          // Сколько названий нужно всего
+		uint32_t covered = 0;                      // Названия до этой позиции уже просмотрены на этом уровне
+		std::unordered_set<uint32_t> emitted;      // Позиции выданных названий (со всех уровней)
+		std::vector<NameMatch> result;
+	};
+
+	// Обходит поддерево узла. false - ответ набран, обход прекращен
+	bool Search(uint32_t node, size_t depth, const std::u32string& query,
+				std::vector<std::vector<uint32_t>>& rows, SearchState& state) const;
+	// Выдает еще не выданные названия отрезка [begin, end). false - ответ набран
+	bool Emit(uint32_t begin, uint32_t end, SearchState& state) const;
+
+	std::vector<Node> nodes_;            // nodes_[0] - корень
+	std::vector<NameMatch> entries_;     // Названия в порядке приведенных строк (edits не заполнено)
+};
+
+}
@@ -0,0 +1,175 @@
+#include "network_analytics.h"
+#include "parallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace transport_catalogue
+{
+
+namespace
+{
+
+// Элементов снимка на поток: обработка элемента дешевле создания потока
+const size_t ANALYTICS_MIN_CHUNK = 4096;
+
+// Частичный результат по отрезку остановок
+struct StopsPart
+{
+	std::vector<StopStatPtr> top;
+	std::vector<size_t> stops_by_degree;
+};
+
+// Частичный результат по отрезку маршрутов
+struct RoutesPart
+{
+	std::vector<RouteStatPtr> top;
+	size_t non_empty = 0;
+	int64_t total_length = 0;
+	size_t total_stops = 0;
+	size_t curved = 0;              // Маршруты с конечной извилистостью (географическая длина > 0)
+	double total_curvature = 0.0;
+};
+
+bool IsBusier(StopStatPtr lhs, StopStatPtr rhs)
+{
+	if (lhs->buses.size() != rhs->buses.size())
+	{
+		return lhs->buses.size() > rhs->buses.size();
+	}
+	return lhs->name < rhs->name;
+}
+
+bool IsLonger(RouteStatPtr lhs, RouteStatPtr rhs)
+{
+	if (lhs->meters_route_length != rhs->meters_route_length)
+	{
+		return lhs->meters_route_length > rhs->meters_route_length;
+	}
+	return lhs->name < rhs->name;
+}
+
+// Оставляет в векторе count лучших элементов по порядку
+template <typename Item, typename Less>
+void KeepTop(std::vector<Item>& items, size_t count, Less less)
+{
+	if (items.size() > count)
+	{
+		std::partial_sort(items.begin(), items.begin() + count, items.end(), less);
+		items.resize(count);
+	}
+	else
+	{
+		std::sort(items.begin(), items.end(), less);
+	}
+}
+
+} // namespace
+
+NetworkAnalytics ComputeNetworkAnalytics(const FrozenCatalogue& tc, size_t top_count)
+{
+	NetworkAnalytics result;
+	result.stops_count = tc.GetStopsCount();
+	result.routes_count = tc.GetRoutesCount();
+
+	// 1. Остановки: гистограмма количества маршрутов и самые загруженные остановки
+	StopsPart stops = parallel::ReduceChunks(result.stops_count, ANALYTICS_MIN_CHUNK, StopsPart{},
+		[&tc, top_count](size_t begin, size_t end)
+		{
+			StopsPart part;
+			for (StopId id = static_cast<StopId>(begin); id < end; ++id)
+			{
+				const StopStatPtr stat = tc.GetStopStat(id);
+				const size_t degree = stat->buses.size();
+				if (part.stops_by_degree.size() <= degree)
+				{
+					part.stops_by_degree.resize(degree + 1, 0);
+				}
+				++part.stops_by_degree[degree];
+				if (degree > 0)
+				{
+					part.top.push_back(stat);
+				}
+			}
+			KeepTop(part.top, top_count, IsBusier);
+			return part;
+		},
+		[top_count](StopsPart& total, StopsPart&& part)
+		{
+			if (total.stops_by_degree.size() < part.stops_by_degree.size())
+			{
+				total.stops_by_degree.resize(part.stops_by_degree.size(), 0);
+			}
+			for (size_t degree = 0; degree < part.stops_by_degree.size(); ++degree)
+			{
+				total.stops_by_degree[degree] += part.stops_by_degree[degree];
+			}
+			total.top.insert(total.top.end(), part.top.begin(), part.top.end());
+			KeepTop(total.top, top_count, IsBusier);
+		});
+
+	result.busiest_stops = std::move(stops.top);
+	result.stops_by_degree = std::move(stops.stops_by_degree);
+	for (size_t degree = 1; degree < result.stops_by_degree.size(); ++degree)
+	{
+		result.served_stops_count += result.stops_by_degree[degree];
+		if (degree > 1)
+		{
+			result.transfer_stops_count += result.stops_by_degree[degree];
+		}
+	}
+
+	// 2. Маршруты: суммы для средних значений и самые длинные маршруты. Пустые маршруты не учитываются
+	RoutesPart routes = parallel::ReduceChunks(result.routes_count, ANALYTICS_MIN_CHUNK, RoutesPart{},
+		[&tc, top_count](size_t begin, size_t end)
+		{
+			RoutesPart part;
+			for (RouteId id = static_cast<RouteId>(begin); id < end; ++id)
+			{
+				const RouteStatPtr stat = tc.GetRouteStat(id);
+				if (stat->stops_on_route == 0)
+				{
+					continue;
+				}
+				++part.non_empty;
+				part.total_length += stat->meters_route_length;
+				part.total_stops += stat->stops_on_route;
+				if (std::isfinite(stat->curvature))
+				{
+					++part.curved;
+					part.total_curvature += stat->curvature;
+				}
+				part.top.push_back(stat);
+			}
+			KeepTop(part.top, top_count, IsLonger);
+			return part;
+		},
+		[top_count](RoutesPart& total, RoutesPart&& part)
+		{
+			total.non_empty += part.non_empty;
+			total.total_length += part.total_length;
+			total.total_stops += part.total_stops;
+			total.curved += part.curved;
+			total.total_curvature += part.total_curvature;
+			total.top.insert(total.top.end(), part.top.begin(), part.top.end());
+			KeepTop(total.top, top_count, IsLonger);
+		});
+
+	result.longest_routes = std::move(routes.top);
+	result.total_route_length = routes.total_length;
+	if (routes.non_empty > 0)
+	{
+		const double count = static_cast<double>(routes.non_empty);
+		result.average_route_length = static_cast<double>(routes.total_length) / count;
+		result.average_stops_on_route = static_cast<double>(routes.total_stops) / count;
+	}
+	// Маршрут нулевой географической длины имеет бесконечную извилистость и в среднее не входит
+	if (routes.curved > 0)
+	{
+		result.average_curvature = routes.total_curvature / static_cast<double>(routes.curved);
+	}
+	return result;
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Назначение модуля: сводные показатели всей сети для запроса Analytics.
+ *
+ * Показатели считаются за один проход по массивам готовых ответов снимка (по номерам
+ * остановок и маршрутов) параллельной сверткой parallel::ReduceChunks: каждый поток
+ * собирает частичный результат своего отрезка (суммы, гистограмму, лучшие элементы),
+ * частичные результаты объединяются по порядку отрезков. Лучшие остановки и маршруты
+ * упорядочены полностью (при равенстве - по названию), поэтому их списки не зависят
+ * от числа потоков.
+ */
+
+#pragma once
+
+#include "frozen_catalogue.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace transport_catalogue
+{
+
+// Показатели сети
+struct NetworkAnalytics
+{
+	size_t stops_count = 0;
+	size_t routes_count = 0;
+	size_t served_stops_count = 0;       // Остановки, через которые идет хотя бы один маршрут
+	size_t transfer_stops_count = 0;     // Остановки, через которые идут несколько маршрутов
+	int64_t total_route_length = 0;      // Сумма длин маршрутов, метров
+	double average_route_length = 0.0;   // Средние значения - по непустым маршрутам
+	double average_stops_on_route = 0.0;
+	double average_curvature = 0.0;      // По маршрутам ненулевой географической длины
+	std::vector<StopStatPtr> busiest_stops;     // Остановки по убыванию количества маршрутов
+	std::vector<RouteStatPtr> longest_routes;   // Маршруты по убыванию длины
+	std::vector<size_t> stops_by_degree;        // Количество остановок по количеству маршрутов через них
+};
+
+// Считает показатели снимка. top_count - количество лучших остановок и маршрутов в ответе
+NetworkAnalytics ComputeNetworkAnalytics(const FrozenCatalogue&, size_t top_count);
+
+}
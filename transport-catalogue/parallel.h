@@ -0,0 +1,142 @@
+/*
+ * Назначение модуля: простейшее распараллеливание независимых вычислений на std::thread.
+ *
+ * Диапазон [0, count) делится на непрерывные отрезки по числу аппаратных потоков.
+ * Первый отрезок обрабатывает вызывающий поток, остальные - временные потоки.
+ * Маленькие диапазоны (меньше min_chunk элементов на поток) обрабатываются без
+ * создания потоков. Исключение из любого отрезка передается вызывающей стороне
+ * после завершения всех потоков.
+ * Свертка (ReduceChunks) считает частичный результат каждого отрезка в своем потоке
+ * и объединяет частичные результаты в порядке отрезков, поэтому ответ не зависит
+ * от числа потоков, если объединение ассоциативно.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace parallel
+{
+
+// Количество потоков для обработки count элементов (не меньше 1)
+inline size_t GetThreadsCount(size_t count, size_t min_chunk)
+{
+	const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1U);
+	const size_t by_size = count / std::max<size_t>(min_chunk, 1U);
+	return std::max<size_t>(std::min(hardware, by_size), 1U);
+}
+
+// Вызывает func(begin, end) для непересекающихся отрезков, покрывающих [0, count).
+// Отрезки обрабатываются параллельно, func не должна изменять общие данные без синхронизации
+template <typename Func>
+void ForEachChunk(size_t count, size_t min_chunk, Func func)
+{
+	if (count == 0)
+	{
+		return;
+	}
+	const size_t threads_count = GetThreadsCount(count, min_chunk);
+	if (threads_count == 1)
+	{
+		func(size_t{ 0 }, count);
+		return;
+	}
+
+	const size_t chunk = (count + threads_count - 1) / threads_count;
+	std::vector<std::exception_ptr> errors(threads_count);
+	std::vector<std::thread> threads;
+	threads.reserve(threads_count - 1);
+	try
+	{
+		for (size_t t = 1; t < threads_count; ++t)
+		{
+			const size_t begin = std::min(t * chunk, count);
+			const size_t end = std::min(begin + chunk, count);
+			threads.emplace_back([&func, &errors, t, begin, end]()
+				{
+					try
+					{
+						func(begin, end);
+					}
+					catch (...)
+					{
+						errors[t] = std::current_exception();
+					}
+				});
+		}
+	}
+	catch (...)
+	{
+		// Поток не создан (std::system_error): уже запущенные потоки ссылаются на func и errors,
+		// и разрушение присоединяемого std::thread вызовет std::terminate - дожидаемся их
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		throw;
+	}
+	try
+	{
+		func(size_t{ 0 }, std::min(chunk, count));
+	}
+	catch (...)
+	{
+		errors[0] = std::current_exception();
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	for (const auto& error : errors)
+	{
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+// Вызывает func(i) для каждого i из [0, count), распределяя элементы по потокам
+template <typename Func>
+void ForEachIndex(size_t count, size_t min_chunk, Func func)
+{
+	ForEachChunk(count, min_chunk, [&func](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				func(i);
+			}
+		});
+}
+
+// Свертка [0, count): chunk_func(begin, end) возвращает результат отрезка,
+// combine(Result& total, Result&& part) добавляет его к итогу. Отрезки объединяются по порядку
+template <typename Result, typename ChunkFunc, typename Combine>
+Result ReduceChunks(size_t count, size_t min_chunk, Result init, ChunkFunc chunk_func, Combine combine)
+{
+	if (count == 0)
+	{
+		return init;
+	}
+	const size_t threads_count = GetThreadsCount(count, min_chunk);
+	const size_t chunk = (count + threads_count - 1) / threads_count;
+	std::vector<Result> parts(threads_count, init);
+	ForEachIndex(threads_count, 1, [&](size_t t)
+		{
+			const size_t begin = std::min(t * chunk, count);
+			parts[t] = chunk_func(begin, std::min(begin + chunk, count));
+		});
+	for (auto& part : parts)
+	{
+		combine(init, std::move(part));
+	}
+	return init;
+}
+
+}
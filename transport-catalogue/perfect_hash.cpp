@@ -0,0 +1,219 @@
+#include "perfect_hash.h"
+#include "memory_report.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace transport_catalogue
+{
+
+namespace
+{
+
+// Финализатор splitmix64: равномерно перемешивает все биты 64-битного числа
+uint64_t Mix(uint64_t x)
+{
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+// Ограничения поиска: при неудаче строим заново с другим зерном
+const uint32_t MAX_DISPLACEMENT = 1U << 20;
+const int MAX_SEEDS = 64;
+
+} // namespace
+
+// ----------- PerfectHash ---------------
+
+PerfectHash::PerfectHash(const std::vector<std::string_view>& keys)
+{
+	data_.keys_count = static_cast<uint32_t>(keys.size());
+	for (int attempt = 0; attempt < MAX_SEEDS; ++attempt)
+	{
+		data_.seed = Mix(static_cast<uint64_t>(attempt));
+		if (TryBuild(keys))
+		{
+			return;
+		}
+	}
+	// Практически недостижимо для различных ключей; совпадающие ключи разместить нельзя
+	throw std::invalid_argument("Can't build perfect hash: duplicate keys?");
+}
+
+
+PerfectHash::PerfectHash(PerfectHashData data) : data_(std::move(data))
+{}
+
+
+uint64_t PerfectHash::HashString(std::string_view key, uint64_t seed)
+{
+	// FNV-1a с зерном и финальным перемешиванием
+	uint64_t hash = 0xCBF29CE484222325ULL ^ seed;
+	for (const char c : key)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 0x100000001B3ULL;
+	}
+	return Mix(hash);
+}
+
+
+size_t PerfectHash::GetBucket(uint64_t hash) const
+{
+	return static_cast<size_t>(hash % data_.displacements.size());
+}
+
+
+size_t PerfectHash::GetSlot(uint64_t hash, uint32_t displacement) const
+{
+	return static_cast<size_t>(Mix(hash ^ (static_cast<uint64_t>(displacement) << 32)) % data_.keys_count);
+}
+
+
+bool PerfectHash::TryBuild(const std::vector<std::string_view>& keys)
+{
+	const size_t buckets_count = keys.size() / BUCKET_LOAD + 1;
+	data_.displacements.assign(buckets_count, 0U);
+
+	// 1. Раскладываем хэши ключей по корзинам
+	std::vector<std::vector<uint64_t>> buckets(buckets_count);
+	for (const std::string_view key : keys)
+	{
+		const uint64_t hash = HashString(key, data_.seed);
+		buckets[GetBucket(hash)].push_back(hash);
+	}
+
+	// 2. Большие корзины размещаем первыми, пока таблица почти пуста
+	std::vector<size_t> order(buckets_count);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&buckets](size_t lhs, size_t rhs)
+					 {
+						 return buckets[lhs].size() > buckets[rhs].size();
+					 });
+
+	std::vector<char> taken(keys.size(), 0);
+	std::vector<size_t> slots;
+	for (const size_t bucket : order)
+	{
+		if (buckets[bucket].empty())
+		{
+			break;
+		}
+		bool placed = false;
+		for (uint32_t displacement = 0; displacement < MAX_DISPLACEMENT && !placed; ++displacement)
+		{
+			// Все ключи корзины должны попасть в свободные и различные ячейки
+			slots.clear();
+			placed = true;
+			for (const uint64_t hash : buckets[bucket])
+			{
+				const size_t slot = GetSlot(hash, displacement);
+				if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end())
+				{
+					placed = false;
+					break;
+				}
+				slots.push_back(slot);
+			}
+			if (placed)
+			{
+				data_.displacements[bucket] = displacement;
+				for (const size_t slot : slots)
+				{
+					taken[slot] = 1;
+				}
+			}
+		}
+		if (!placed)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+size_t PerfectHash::Find(std::string_view key) const
+{
+	if (data_.keys_count == 0 || data_.displacements.empty())
+	{
+		return NPOS;
+	}
+	const uint64_t hash = HashString(key, data_.seed);
+	return GetSlot(hash, data_.displacements[GetBucket(hash)]);
+}
+
+
+const PerfectHashData& PerfectHash::GetData() const
+{
+	return data_;
+}
+
+
+size_t PerfectHash::Size() const
+{
+	return data_.keys_count;
+}
+
+// ----------- PerfectHashIndex ---------------
+
+PerfectHashIndex::PerfectHashIndex(const std::vector<std::string_view>& names) : hash_(names)
+{
+	FillIds(names);
+}
+
+
+PerfectHashIndex::PerfectHashIndex(PerfectHashData data, const std::vector<std::string_view>& names)
+	: hash_(std::move(data))
+{
+	if (!FillIds(names))
+	{
+		hash_ = PerfectHash(names);
+		FillIds(names);
+	}
+}
+
+
+bool PerfectHashIndex::FillIds(const std::vector<std::string_view>& names)
+{
+	if (hash_.Size() != names.size())
+	{
+		return false;
+	}
+	ids_.assign(names.size(), NO_ID);
+	for (uint32_t id = 0; id < names.size(); ++id)
+	{
+		const size_t slot = hash_.Find(names[id]);
+		if (slot >= ids_.size() || ids_[slot] != NO_ID)
+		{
+			return false;
+		}
+		ids_[slot] = id;
+	}
+	return true;
+}
+
+
+uint32_t PerfectHashIndex::FindCandidate(std::string_view name) const
+{
+	const size_t slot = hash_.Find(name);
+	return (slot == PerfectHash::NPOS) ? NO_ID : ids_[slot];
+}
+
+
+const PerfectHashData& PerfectHashIndex::GetData() const
+{
+	return hash_.GetData();
+}
+
+
+size_t PerfectHashIndex::GetMemoryUsage() const
+{
+	return memory_report::VectorBytes(hash_.GetData().displacements) + memory_report::VectorBytes(ids_);
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+ * Назначение модуля: минимальная совершенная хэш-функция над неизменным набором строк.
+ *
+ * Построение по схеме CHD (Compress, Hash and Displace): ключи раскладываются по корзинам
+ * (в среднем BUCKET_LOAD ключей в корзине), затем корзины в порядке убывания размера
+ * получают такое смещение, чтобы все их ключи попали в свободные ячейки таблицы размером
+ * ровно n. Поиск - один проход хэша по строке и два перемешивания 64-битного числа.
+ * Функция не хранит ключи: для чужой строки она возвращает какую-то ячейку, поэтому
+ * вызывающая сторона обязана сравнить строку с ключом этой ячейки.
+ *
+ * Хэш не зависит от платформы и реализации std::hash, поэтому параметры функции
+ * можно сериализовать и восстановить без повторного построения.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace transport_catalogue
+{
+
+// Параметры построенной функции (то, что сериализуется)
+struct PerfectHashData
+{
+	uint64_t seed = 0;                      // Зерно строкового хэша
+	uint32_t keys_count = 0;                // Количество ключей == размер таблицы
+	std::vector<uint32_t> displacements;    // Смещения корзин
+};
+
+// ----------- PerfectHash ---------------
+
+class PerfectHash
+{
+public:
+	static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+	PerfectHash() = default;
+	// Строит функцию для набора различных ключей
+	explicit PerfectHash(const std::vector<std::string_view>& keys);
+	// Восстанавливает ранее построенную функцию по ее параметрам
+	explicit PerfectHash(PerfectHashData data);
+
+	// Возвращает ячейку [0, n) ключа (NPOS для пустой функции). Для строки не из
+	// набора ключей результат - произвольная ячейка
+	size_t Find(std::string_view key) const;
+
+	const PerfectHashData& GetData() const;
+	size_t Size() const;
+
+private:
+	static constexpr uint32_t BUCKET_LOAD = 4;    // Среднее количество ключей в корзине
+
+	static uint64_t HashString(std::string_view key, uint64_t seed);
+	size_t GetBucket(uint64_t hash) const;
+	size_t GetSlot(uint64_t hash, uint32_t displacement) const;
+
+	// Пытается разместить все ключи при текущем зерне. false - нужно другое зерно
+	bool TryBuild(const std::vector<std::string_view>& keys);
+
+	PerfectHashData data_;
+};
+
+// ----------- PerfectHashIndex ---------------
+
+// Индекс "название -> номер" над неизменным набором названий, номер - позиция названия
+// в наборе. Названия не хранятся: найденного кандидата нужно сравнить с искомой строкой
+class PerfectHashIndex
+{
+public:
+	static constexpr uint32_t NO_ID = UINT32_MAX;
+
+	PerfectHashIndex() = default;
+	// Строит индекс по набору различных названий
+	explicit PerfectHashIndex(const std::vector<std::string_view>& names);
+	// Восстанавливает индекс по сохраненным параметрам функции. Если они не подходят
+	// к набору названий (база старого формата, другие данные), строит индекс заново
+	PerfectHashIndex(PerfectHashData data, const std::vector<std::string_view>& names);
+
+	// Возвращает номер-кандидат для названия (NO_ID для пустого индекса)
+	uint32_t FindCandidate(std::string_view name) const;
+
+	const PerfectHashData& GetData() const;
+	// Динамическая память функции и таблицы номеров, байт
+	size_t GetMemoryUsage() const;
+
+private:
+	// Заполняет таблицу "ячейка -> номер". false - функция не совершенна для этих названий
+	bool FillIds(const std::vector<std::string_view>& names);
+
+	PerfectHash hash_;
+	std::vector<uint32_t> ids_;    // Номер названия по ячейке функции
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <iterator>
 #include <string_view>
 #include <unordered_map>
@@ -26,6 +27,19 @@ public:
     {
         return end_;
     }
+    // Для итераторов произвольного доступа
+    size_t size() const
+    {
+        return static_cast<size_t>(std::distance(begin_, end_));
+    }
+    bool empty() const
+    {
+        return begin_ == end_;
+    }
+    decltype(auto) operator[](size_t index) const
+    {
+        return begin_[index];
+    }
 
 private:
     It begin_;
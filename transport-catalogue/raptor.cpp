@@ -0,0 +1,268 @@
+#include "raptor.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace router
+{
+
+namespace
+{
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+} // namespace
+
+// -----------------Raptor-------------------------
+
+Raptor::Raptor(const transport_catalogue::FrozenCatalogue& tc, int bus_wait_time, int bus_velocity)
+	: wait_time_(bus_wait_time * 1.0), meters_per_minute_(bus_velocity * 1000.0 / 60.0)
+{
+	// 1. Остановки уже имеют плотные номера - достаточно их количества
+	stops_count_ = tc.GetStopsCount();
+
+	// 2. Последовательности остановок маршрутов и накопленные расстояния хранятся подряд
+	std::vector<uint32_t> stop_routes_count(stops_count_ + 1, 0U);
+	for (const transport_catalogue::RouteId route : tc.GetRoutesByName())
+	{
+		const transport_catalogue::RouteTraversal stops = tc.GetRouteStops(route);
+		RouteSpan span{ route, static_cast<uint32_t>(route_stops_.size()), static_cast<uint32_t>(stops.size()) };
+		double meters = 0.0;
+		for (size_t i = 0; i < stops.size(); ++i)
+		{
+			if (i > 0)
+			{
+				meters += static_cast<double>(tc.GetDistance(stops[i - 1], stops[i]));
+			}
+			const uint32_t stop_index = stops[i];
+			route_stops_.push_back(stop_index);
+			route_meters_.push_back(meters);
+			++stop_routes_count[stop_index];
+		}
+		routes_.push_back(span);
+	}
+
+	// 3. Обратный индекс "остановка -> (маршрут, позиция)" в формате CSR
+	stop_routes_offsets_.assign(stops_count_ + 1, 0U);
+	for (size_t i = 0; i < stops_count_; ++i)
+	{
+		stop_routes_offsets_[i + 1] = stop_routes_offsets_[i] + stop_routes_count[i];
+	}
+	stop_routes_.resize(route_stops_.size());
+	std::vector<uint32_t> fill(stop_routes_offsets_.begin(), stop_routes_offsets_.end() - 1);
+	for (uint32_t route_index = 0; route_index < routes_.size(); ++route_index)
+	{
+		const RouteSpan& span = routes_[route_index];
+		for (uint32_t pos = 0; pos < span.count; ++pos)
+		{
+			stop_routes_[fill[route_stops_[span.first + pos]]++] = { route_index, pos };
+		}
+	}
+
+	// 4. Массивы поиска в исходном состоянии
+	best_.assign(stops_count_, INF);
+	round_start_.assign(stops_count_, INF);
+	last_label_.assign(stops_count_, NONE);
+	is_marked_.assign(stops_count_, 0);
+	route_start_.assign(routes_.size(), NONE);
+}
+
+
+double Raptor::GetRideTime(const RouteSpan& span, uint32_t board_pos, uint32_t alight_pos) const
+{
+	// Время поездки считается так же, как вес ребра графа TransportRouter:
+	// суммарное расстояние по дорогам, деленное на скорость
+	return (route_meters_[span.first + alight_pos] - route_meters_[span.first + board_pos]) / meters_per_minute_;
+}
+
+
+std::optional<RaptorJourney> Raptor::FindJourney(transport_catalogue::StopId from, transport_catalogue::StopId to,
+												 size_t max_transfers) const
+{
+	RaptorJourney journey;
+	const auto total_time = FindJourney(from, to, max_transfers, journey.legs);
+	if (!total_time)
+	{
+		return std::nullopt;
+	}
+	journey.total_time = *total_time;
+	return journey;
+}
+
+
+std::optional<double> Raptor::FindJourney(transport_catalogue::StopId from, transport_catalogue::StopId to,
+										  size_t max_transfers, std::vector<RaptorLeg>& legs) const
+{
+	legs.clear();
+	if (from >= stops_count_ || to >= stops_count_)
+	{
+		return std::nullopt;
+	}
+	const uint32_t source = from;
+	const uint32_t target = to;
+
+	// Массивы могли остаться заполненными после прошлого запроса
+	ResetSearch();
+	best_[source] = 0.0;
+	round_start_[source] = 0.0;
+	reached_stops_.push_back(source);
+	is_marked_[source] = 1;
+	marked_stops_.push_back(source);
+
+	for (uint32_t round = 1; round <= max_transfers + 1 && !marked_stops_.empty(); ++round)
+	{
+		// 1. Собираем маршруты, проходящие через отмеченные остановки,
+		//    запоминая для каждого самую раннюю отмеченную позицию
+		for (const uint32_t stop : marked_stops_)
+		{
+			for (uint32_t i = stop_routes_offsets_[stop]; i < stop_routes_offsets_[stop + 1]; ++i)
+			{
+				const auto [route_index, pos] = stop_routes_[i];
+				if (route_start_[route_index] == NONE)
+				{
+					queued_routes_.push_back(route_index);
+					route_start_[route_index] = pos;
+				}
+				else if (pos < route_start_[route_index])
+				{
+					route_start_[route_index] = pos;
+				}
+			}
+			is_marked_[stop] = 0;
+		}
+		marked_stops_.clear();
+
+		// 2. Проходим каждый маршрут от самой ранней отмеченной позиции до конца
+		for (const uint32_t route_index : queued_routes_)
+		{
+			const RouteSpan& span = routes_[route_index];
+			std::optional<uint32_t> board_pos;    // Позиция посадки текущего "рейса"
+			double board_time = INF;              // Время отправления с позиции посадки (с учетом ожидания)
+
+			for (uint32_t pos = route_start_[route_index]; pos < span.count; ++pos)
+			{
+				const uint32_t stop = route_stops_[span.first + pos];
+				double ride_arrival = INF;
+				if (board_pos)
+				{
+					ride_arrival = board_time + GetRideTime(span, *board_pos, pos);
+					// Отсечение: прибытие должно улучшать и метку остановки, и лучшее время до цели
+					if (ride_arrival < best_[stop] && ride_arrival < best_[target])
+					{
+						if (best_[stop] == INF)
+						{
+							reached_stops_.push_back(stop);
+						}
+						best_[stop] = ride_arrival;
+						SetLabel(stop, round, route_index, *board_pos, pos);
+						if (!is_marked_[stop])
+						{
+							is_marked_[stop] = 1;
+							marked_stops_.push_back(stop);
+						}
+					}
+				}
+				// Можно ли сесть здесь на более выгодный "рейс"? Садиться можно только
+				// с метки предыдущего раунда, иначе число автобусов превысит номер раунда
+				if (round_start_[stop] < INF && round_start_[stop] + wait_time_ < ride_arrival)
+				{
+					board_pos = pos;
+					board_time = round_start_[stop] + wait_time_;
+				}
+			}
+			route_start_[route_index] = NONE;
+		}
+		queued_routes_.clear();
+
+		// Улучшенные в раунде остановки переходят в начало следующего раунда
+		for (const uint32_t stop : marked_stops_)
+		{
+			round_start_[stop] = best_[stop];
+		}
+	}
+
+	// 3. Лучшее время до цели достигнуто в раунде ее последней метки - наименьшем из возможных
+	if (best_[target] == INF)
+	{
+		return std::nullopt;
+	}
+	uint32_t round = (target == source) ? 0 : labels_[last_label_[target]].round;
+
+	// 4. Восстанавливаем участки пути от цели к началу
+	uint32_t stop = target;
+	while (stop != source)
+	{
+		// Метка могла быть установлена в одном из предыдущих раундов
+		uint32_t index = last_label_[stop];
+		while (labels_[index].round > round)
+		{
+			index = labels_[index].previous;
+		}
+		const Label& label = labels_[index];
+		const RouteSpan& span = routes_[label.route];
+		const uint32_t board_stop = route_stops_[span.first + label.board_pos];
+		legs.push_back(RaptorLeg{ board_stop, span.route,
+								  static_cast<int>(label.alight_pos - label.board_pos),
+								  GetRideTime(span, label.board_pos, label.alight_pos) });
+		stop = board_stop;
+		round = label.round - 1;
+	}
+	std::reverse(legs.begin(), legs.end());
+
+	// Суммируем время в порядке следования, как это делает TransportRouter
+	double total_time = 0.0;
+	for (const auto& leg : legs)
+	{
+		total_time += wait_time_;
+		total_time += leg.ride_time;
+	}
+	return total_time;
+}
+
+
+void Raptor::SetLabel(uint32_t stop, uint32_t round, uint32_t route, uint32_t board_pos, uint32_t alight_pos) const
+{
+	// Улучшение в том же раунде заменяет метку, в новом раунде - добавляет ее в список остановки
+	const uint32_t last = last_label_[stop];
+	if (last != NONE && labels_[last].round == round)
+	{
+		labels_[last] = Label{ round, route, board_pos, alight_pos, labels_[last].previous };
+		return;
+	}
+	last_label_[stop] = static_cast<uint32_t>(labels_.size());
+	labels_.push_back(Label{ round, route, board_pos, alight_pos, last });
+}
+
+
+void Raptor::ResetSearch() const
+{
+	for (const uint32_t stop : reached_stops_)
+	{
+		best_[stop] = INF;
+		round_start_[stop] = INF;
+		last_label_[stop] = NONE;
+		is_marked_[stop] = 0;
+	}
+	for (const uint32_t route_index : queued_routes_)
+	{
+		route_start_[route_index] = NONE;
+	}
+	reached_stops_.clear();
+	marked_stops_.clear();
+	queued_routes_.clear();
+	labels_.clear();
+}
+
+
+
+void Raptor::ReportMemory(memory_report::MemoryReport& report) const
+{
+	using namespace memory_report;
+	report.Add("Raptor", "routes", VectorBytes(routes_) + VectorBytes(route_stops_) + VectorBytes(route_meters_));
+	report.Add("Raptor", "stop_routes", VectorBytes(stop_routes_offsets_) + VectorBytes(stop_routes_));
+	report.Add("Raptor", "query_buffers", VectorBytes(best_) + VectorBytes(round_start_) + VectorBytes(last_label_)
+			   + VectorBytes(labels_) + VectorBytes(is_marked_) + VectorBytes(marked_stops_) + VectorBytes(reached_stops_)
+			   + VectorBytes(route_start_) + VectorBytes(queued_routes_));
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+ * Назначение модуля: поиск маршрутов алгоритмом RAPTOR (Round-bAsed Public Transit Optimized Router).
+ *
+ * RAPTOR не строит граф: он работает напрямую с последовательностями остановок маршрутов.
+ * Индекс остановки во всех массивах совпадает с ее номером StopId в каталоге.
+ * Раунд k находит лучшее время прибытия на остановки, использующее не более k автобусов
+ * (k - 1 пересадок), линейным проходом по маршрутам, затронутым в предыдущем раунде.
+ * Поэтому ограничение на количество пересадок выполняется естественным образом.
+ * Массивы поиска принадлежат объекту и сбрасываются по списку достигнутых остановок,
+ * поэтому запрос не выделяет памяти и не проходит по всем остановкам. Из-за общих
+ * массивов одновременные запросы к одному объекту не допускаются.
+ */
+
+#pragma once
+
+#include "frozen_catalogue.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace router
+{
+
+// Участок пути: ожидание автобуса на остановке посадки и поездка на нем
+struct RaptorLeg
+{
+	transport_catalogue::StopId board_stop = 0;            // Остановка посадки
+	transport_catalogue::RouteId route = 0;                // Маршрут автобуса
+	int span_count = 0;                                    // Количество перегонов без пересадок
+	double ride_time = 0.0;                                // Время поездки, минут
+};
+
+// Найденный RAPTOR путь
+struct RaptorJourney
+{
+	double total_time = 0.0;           // Суммарное время в пути (с учетом ожиданий)
+	std::vector<RaptorLeg> legs;       // Участки пути по порядку следования
+};
+
+// -----------------Raptor-------------------------
+
+class Raptor
+{
+public:
+	// Подготавливает плоские массивы маршрутов и остановок каталога.
+	// bus_wait_time - время ожидания автобуса (мин), bus_velocity - скорость автобуса (км/ч)
+	Raptor(const transport_catalogue::FrozenCatalogue&, int bus_wait_time, int bus_velocity);
+
+	// Возвращает самый быстрый путь между остановками, содержащий не более max_transfers пересадок
+	std::optional<RaptorJourney> FindJourney(transport_catalogue::StopId from, transport_catalogue::StopId to,
+											 size_t max_transfers) const;
+	// Записывает участки пути в буфер вызывающей стороны (буфер очищается, его емкость
+	// переиспользуется). Возвращает суммарное время в пути или nullopt, если пути нет
+	std::optional<double> FindJourney(transport_catalogue::StopId from, transport_catalogue::StopId to,
+									  size_t max_transfers, std::vector<RaptorLeg>& legs) const;
+
+	// Добавляет в отчет память массивов маршрутов и остановок
+	void ReportMemory(memory_report::MemoryReport&) const;
+
+private:
+	static constexpr uint32_t NONE = UINT32_MAX;
+
+	// Маршрут: отрезок [first, first + count) в массивах route_stops_ / route_meters_
+	struct RouteSpan
+	{
+		transport_catalogue::RouteId route = 0;
+		uint32_t first = 0;
+		uint32_t count = 0;
+	};
+
+	// Способ, которым остановка была достигнута в раунде. Метки остановки образуют список
+	// от последнего раунда к первому
+	struct Label
+	{
+		uint32_t round = 0;            // Раунд, в котором метка установлена
+		uint32_t route = NONE;         // Индекс маршрута
+		uint32_t board_pos = 0;        // Позиция посадки в маршруте
+		uint32_t alight_pos = 0;       // Позиция высадки в маршруте
+		uint32_t previous = NONE;      // Метка той же остановки из более раннего раунда
+	};
+
+	double GetRideTime(const RouteSpan& span, uint32_t board_pos, uint32_t alight_pos) const;
+	// Записывает метку остановки, улучшенной в раунде round
+	void SetLabel(uint32_t stop, uint32_t round, uint32_t route, uint32_t board_pos, uint32_t alight_pos) const;
+	// Возвращает массивы поиска в исходное состояние (по списку достигнутых остановок)
+	void ResetSearch() const;
+
+	double wait_time_ = 0.0;                                  // Время ожидания автобуса, минут
+	double meters_per_minute_ = 1.0;                          // Скорость автобуса, метров в минуту
+
+	size_t stops_count_ = 0;                                  // Количество остановок (индекс == StopId)
+
+	std::vector<RouteSpan> routes_;                           // Маршруты по индексу
+	std::vector<uint32_t> route_stops_;                       // Индексы остановок всех маршрутов подряд
+	std::vector<double> route_meters_;                        // Расстояние по дорогам от начала маршрута до остановки
+
+	// Для каждой остановки - пары (маршрут, позиция) проходящих через нее маршрутов
+	// в формате CSR: элементы остановки s лежат в [stop_routes_offsets_[s], stop_routes_offsets_[s + 1])
+	std::vector<uint32_t> stop_routes_offsets_;
+	std::vector<std::pair<uint32_t, uint32_t>> stop_routes_;
+
+	// Массивы поиска (размер - число остановок / маршрутов), переиспользуются между запросами.
+	// Время прибытия на остановку не ухудшается от раунда к раунду, поэтому достаточно двух
+	// массивов: лучшее время сейчас и лучшее время к началу раунда
+	mutable std::vector<double> best_;
+	mutable std::vector<double> round_start_;
+	mutable std::vector<uint32_t> last_label_;       // Последняя метка остановки (NONE - не достигнута)
+	mutable std::vector<Label> labels_;
+	mutable std::vector<char> is_marked_;
+	mutable std::vector<uint32_t> marked_stops_;
+	mutable std::vector<uint32_t> reached_stops_;    // Остановки, для которых заполнены массивы
+	mutable std::vector<uint32_t> route_start_;      // Первая отмеченная позиция маршрута
+	mutable std::vector<uint32_t> queued_routes_;
+};
+
+}
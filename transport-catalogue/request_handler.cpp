@@ -71,21 +71,45 @@ namespace transport_catalogue
 
 const std::optional<RouteStatPtr> RequestHandler::GetRouteInfo(const std::string_view& bus_name) const
 {
-	return tc_.GetRouteInfo(bus_name);
+	return tc_->GetRouteInfo(bus_name);
 }
 
 const std::optional<StopStatPtr> RequestHandler::GetBusesForStop(const std::string_view& stop_name) const
 {
-	return tc_.GetBusesForStopInfo(stop_name);
+	return tc_->GetBusesForStopInfo(stop_name);
+}
+
+std::vector<NearbyStop> RequestHandler::GetNearestStops(geo::Coordinates center, size_t count) const
+{
+	return tc_->FindNearestStops(center, count);
+}
+
+std::vector<NearbyStop> RequestHandler::GetStopsInRadius(geo::Coordinates center, double radius) const
+{
+	return tc_->FindStopsInRadius(center, radius);
+}
+
+std::vector<NameSuggestion> RequestHandler::SuggestNames(std::string_view query, size_t count, uint32_t max_edits) const
+{
+	return tc_->SuggestNames(query, count, max_edits);
+}
+
+NetworkAnalytics RequestHandler::GetNetworkAnalytics(size_t top_count) const
+{
+	return ComputeNetworkAnalytics(*tc_, top_count);
 }
 
 svg::Document RequestHandler::GetMapRender() const
 {
-	std::map<const std::string, transport_catalogue::RendererData> all_routes;
-	// Получаем данные обо всех маршрутах (через std::move)
-	tc_.GetAllRoutes(all_routes);
-	// Передаем ссылку на словарь в рендерер
-	return mr_.RenderMap(all_routes);
+	// Рендерер читает маршруты и остановки прямо из хранилища снимка
+	return mr_.RenderMap(tc_->GetRendererData());
+}
+
+void RequestHandler::ReportMemory(memory_report::MemoryReport& report) const
+{
+	tc_->ReportMemory(report);
+	mr_.ReportMemory(report);
+	GetMapRender().ReportMemory(report);
 }
 
 }
@@ -8,13 +8,13 @@
 
 #pragma once
 
-#include "transport_catalogue.h"
+#include "frozen_catalogue.h"
+#include "network_analytics.h"
 #include "map_renderer.h"
 
 #include <unordered_set>    // для типа данных в RequestHandler
 #include <optional>         // для типа данных в RequestHandler
 #include <string_view>      // для типа данных в RequestHandler
-#include <map>              // для передачи словаря всех маршрутов
 
 namespace detail
 {
@@ -37,9 +37,15 @@ class RequestHandler
 {
 public:
     // MapRenderer понадобится в следующей части итогового проекта
-    RequestHandler(const TransportCatalogue& tc, map_renderer::MapRenderer& mr) : tc_(tc), mr_(mr)
+    RequestHandler(const FrozenCatalogue& tc, map_renderer::MapRenderer& mr) : tc_(&tc), mr_(mr)
     {}
 
+    // Переключает обработчик на новый снимок каталога (после изменения каталога)
+    void SetCatalogue(const FrozenCatalogue& tc)
+    {
+        tc_ = &tc;
+    }
+
     // Возвращает информацию о маршруте
     const std::optional<RouteStatPtr> GetRouteInfo(const std::string_view& bus_name) const;
 
@@ -47,12 +53,28 @@ public:
     //const std::unordered_set<BusPtr>* GetBusesByStop(const std::string_view& stop_name) const;
     const std::optional<StopStatPtr> GetBusesForStop(const std::string_view& stop_name) const;
 
+    // Возвращает не более count ближайших к точке остановок
+    std::vector<NearbyStop> GetNearestStops(geo::Coordinates, size_t count) const;
+    // Возвращает остановки не дальше radius метров от точки
+    std::vector<NearbyStop> GetStopsInRadius(geo::Coordinates, double radius) const;
+
+    // Возвращает подсказки названий остановок и маршрутов по началу названия
+    std::vector<NameSuggestion> SuggestNames(std::string_view query, size_t count, uint32_t max_edits) const;
+
+    // Возвращает показатели всей сети (top_count лучших остановок и маршрутов)
+    NetworkAnalytics GetNetworkAnalytics(size_t top_count) const;
+
     // Возвращает SVG документ, сформированный map_renderer
     svg::Document GetMapRender() const;
 
+    // Добавляет в отчет память снимка каталога, рендерера и документа карты (карта строится
+    // заново, как для запроса Map)
+    void ReportMemory(memory_report::MemoryReport&) const;
+
 private:
-    // RequestHandler использует агрегацию объектов "Транспортный Справочник" и "Визуализатор Карты"
-    const TransportCatalogue& tc_;
+    // RequestHandler использует агрегацию объектов "Транспортный Справочник" (его неизменяемого
+    // снимка) и "Визуализатор Карты"
+    const FrozenCatalogue* tc_;
 
     map_renderer::MapRenderer& mr_;
 };
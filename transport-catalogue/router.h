@@ -32,6 +32,19 @@ public:
 
     std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
 
+    // Записывает ребра маршрута в буфер вызывающей стороны (буфер очищается, его емкость
+    // переиспользуется). Возвращает вес маршрута или nullopt, если маршрута нет
+    std::optional<Weight> BuildRoute(VertexId from, VertexId to, std::vector<EdgeId>& edges) const;
+
+    // Добавляет в отчет память матрицы кратчайших путей
+    void ReportMemory(memory_report::MemoryReport& report) const;
+
+    // Объем памяти (байт), который роутер хранит на каждую пару вершин графа
+    static constexpr size_t GetMemoryPerVertexPair()
+    {
+        return sizeof(std::optional<RouteInternalData>);
+    }
+
 private:
     struct RouteInternalData
     {
@@ -115,13 +128,24 @@ template <typename Weight>
 std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(VertexId from,
                                                                              VertexId to) const
 {
+    std::vector<EdgeId> edges;
+    const auto weight = BuildRoute(from, to, edges);
+    if (!weight)
+    {
+        return std::nullopt;
+    }
+    return RouteInfo{ *weight, std::move(edges) };
+}
+
+template <typename Weight>
+std::optional<Weight> Router<Weight>::BuildRoute(VertexId from, VertexId to, std::vector<EdgeId>& edges) const
+{
+    edges.clear();
     const auto& route_internal_data = routes_internal_data_.at(from).at(to);
     if (!route_internal_data)
     {
         return std::nullopt;
     }
-    const Weight weight = route_internal_data->weight;
-    std::vector<EdgeId> edges;
     for (std::optional<EdgeId> edge_id = route_internal_data->prev_edge;
          edge_id;
          edge_id = routes_internal_data_[from][graph_.GetEdge(*edge_id).from]->prev_edge)
@@ -130,7 +154,13 @@ std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(Ver
     }
     std::reverse(edges.begin(), edges.end());
 
-    return RouteInfo{ weight, std::move(edges) };
+    return route_internal_data->weight;
+}
+
+template <typename Weight>
+void Router<Weight>::ReportMemory(memory_report::MemoryReport& report) const
+{
+    report.Add("Router", "routes_internal_data", memory_report::NestedVectorBytes(routes_internal_data_));
 }
 
 }  // namespace graph
\ No newline at end of file
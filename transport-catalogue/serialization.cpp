@@ -22,6 +22,8 @@ void Serializer::Serialize(const std::string& filename)
 	SerializeRoute();
 	SerializeRendererSettings();
 	SerializeRouterSettings();
+	SerializeRouterPartition();
+	SerializeNameIndexes();
 	// Сериализуем прото-структуру в файл
 	proto_all_settings_.SerializeToOstream(&out);
 }
@@ -56,7 +58,42 @@ void Serializer::DeserializeRouter(router::TransportRouter* tr)
 	router::RouterSettings r_settings;
 	r_settings.bus_velocity = proto_rt_settings.bus_velocity();
 	r_settings.bus_wait_time = proto_rt_settings.bus_wait_time();
+	switch (proto_rt_settings.engine())
+	{
+	case proto_serialization::CRP:
+		r_settings.engine = router::RouterEngine::CRP;
+		break;
+	case proto_serialization::AUTO:
+		r_settings.engine = router::RouterEngine::AUTO;
+		break;
+	default:
+		// В базах старого формата поле отсутствует - использовался ALL_PAIRS
+		r_settings.engine = router::RouterEngine::ALL_PAIRS;
+		break;
+	}
+	// Нулевые значения - поля отсутствуют в базе, оставляем настройки по-умолчанию
+	if (proto_rt_settings.crp_cell_size() > 0)
+	{
+		r_settings.crp_cell_size = proto_rt_settings.crp_cell_size();
+	}
+	if (proto_rt_settings.crp_levels() > 0)
+	{
+		r_settings.crp_levels = proto_rt_settings.crp_levels();
+	}
+	if (proto_rt_settings.memory_budget_mb() > 0)
+	{
+		r_settings.memory_budget_mb = proto_rt_settings.memory_budget_mb();
+	}
 	tr_->ApplyRouterSettings(r_settings);
+
+	// Разбиение остановок для CRP (строится в режиме make_base).
+	// Позиция элемента - номер остановки в каталоге
+	router::StopsPartition partition;
+	for (const auto& proto_stop_cells : proto_all_settings_.router_partition().stops())
+	{
+		partition.emplace_back(proto_stop_cells.cells().begin(), proto_stop_cells.cells().end());
+	}
+	tr_->ApplyPartition(std::move(partition));
 }
 
 // Private methods
@@ -65,8 +102,9 @@ void Serializer::SerializeStop()
 {
 	for (const auto& stop : tc_.GetAllStopsPtr())
 	{
-		// stop - элемент вектора типа 
-		// std::vector<StopPtr>
+		// stop - элемент диапазона типа
+		// StopsPtrRange (StopPtr). Остановки идут по порядку номеров,
+		// поэтому при десериализации они получат те же номера
 
 		// Вспомогательные переменные
 		proto_serialization::Stop proto_stop;
@@ -76,7 +114,8 @@ void Serializer::SerializeStop()
 		proto_coords.set_lat(stop->coords.lat);
 		proto_coords.set_lng(stop->coords.lng);
 		*proto_stop.mutable_coords() = proto_coords;
-		proto_stop.set_name(stop->name);
+		proto_stop.set_name(std::string(stop->name));
+		proto_stop.set_is_boundary(stop->is_boundary);
 		// Запоминаем в классовой прото-структуре
 		*proto_all_settings_.add_stops() = proto_stop;
 	}
@@ -85,63 +124,48 @@ void Serializer::SerializeStop()
 
 void Serializer::SerializeDistance()
 {
-	for (const auto& distance : tc_.GetAllDistances())
-	{
-		// distance - элемент словаря типа 
-		// std::unordered_map<std::pair<StopPtr, StopPtr>, size_t...>
-
-		// Вспомогательные переменные
-		proto_serialization::Distance proto_distance;
-
-		// Заполняем временые переменные данными.
-		proto_distance.set_from(distance.first.first->name);
-		proto_distance.set_to(distance.first.second->name);
-		proto_distance.set_distance(distance.second);
-		// Запоминаем в классовой прото-структуре
-		*proto_all_settings_.add_distances() = proto_distance;
-	}
+	tc_.GetAllDistances().ForEach([this](transport_catalogue::StopId from, transport_catalogue::StopId to, size_t distance)
+		{
+			// Вспомогательные переменные
+			proto_serialization::Distance proto_distance;
+
+			// Заполняем временые переменные данными.
+			proto_distance.set_stop_from(from);
+			proto_distance.set_stop_to(to);
+			proto_distance.set_distance(distance);
+			// Запоминаем в классовой прото-структуре
+			*proto_all_settings_.add_distances() = proto_distance;
+		});
 }
 
 void Serializer::SerializeRoute()
 {
+	// Маршруты ссылаются на регионы номерами - сохраняем названия регионов по порядку номеров
+	for (transport_catalogue::RegionId region = 0; region < tc_.GetRegionsCount(); ++region)
+	{
+		proto_all_settings_.add_region_names(std::string(tc_.GetRegionName(region)));
+	}
+
 	for (const auto& route : tc_.GetAllRoutesPtr())
 	{
-		// stop - элемент дека типа 
-		// std::deque<RoutePtr>
+		// route - элемент диапазона типа
+		// RoutesPtrRange (RoutePtr), маршруты по алфавиту
 
 		// Вспомогательные переменные
 		proto_serialization::Route proto_route;
 
 		// Заполняем временые переменные данными.
-		proto_route.set_route_name(route->route_name);
+		proto_route.set_route_name(std::string(route->route_name));
 		proto_route.set_is_circular(route->is_circular);
+		proto_route.set_region(route->region);
 
-		// ВНИМАНИЕ! Некольцевые маршруты в каталоге достраиваются
-		// до кольцевых. Для них сериализовать нужно только 
-		// первую половину остановок + 1
-		size_t num_stops_to_process = (route->is_circular ? route->stops.size() : route->stops.size() / 2 + 1);
-		for (auto stop : route->stops)
+		// Маршрут хранится в каталоге так, как он задан (без обратного направления
+		// некольцевого маршрута) - сохраняем остановки как есть
+		proto_route.mutable_stop_ids()->Reserve(static_cast<int>(route->stops.size()));
+		for (const auto stop_id : route->stops)
 		{
-			// Проверим, достиг ли счетчик необработанных остановок нуля
-			if (num_stops_to_process == 0)
-			{
-				// Достиг. Выходим из цикла
-				break;
-			}
-			--num_stops_to_process;
-
-			// Вспомогательные переменные вложенного цикла
-			proto_serialization::Stop proto_stop;
-			proto_serialization::Coordinates proto_coords;
-
-		    // Заполняем временые переменные данными.
-			proto_coords.set_lat(stop->coords.lat);
-			proto_coords.set_lng(stop->coords.lng);
-			proto_stop.set_name(stop->name);
-			*proto_stop.mutable_coords() = proto_coords;
-
-			// Запоминаем во временной прото-структуре метода
-			*proto_route.add_stops() = proto_stop;
+			// Запоминаем во временной прото-структуре метода только номер остановки
+			proto_route.add_stop_ids(stop_id);
 		}
 
 		// Запоминаем в классовой прото-структуре
@@ -245,55 +269,130 @@ void Serializer::SerializeRouterSettings()
 	// Заполняем временые переменные данными
 	proto_router_settings.set_bus_velocity(rt_settings.bus_velocity);
 	proto_router_settings.set_bus_wait_time(rt_settings.bus_wait_time);
+	switch (rt_settings.engine)
+	{
+	case router::RouterEngine::CRP:
+		proto_router_settings.set_engine(proto_serialization::CRP);
+		break;
+	case router::RouterEngine::AUTO:
+		proto_router_settings.set_engine(proto_serialization::AUTO);
+		break;
+	default:
+		proto_router_settings.set_engine(proto_serialization::ALL_PAIRS);
+		break;
+	}
+	proto_router_settings.set_crp_cell_size(rt_settings.crp_cell_size);
+	proto_router_settings.set_crp_levels(rt_settings.crp_levels);
+	proto_router_settings.set_memory_budget_mb(rt_settings.memory_budget_mb);
 
 	// Запоминаем в классовой прото-структуре
 	*proto_all_settings_.mutable_router_settings() = proto_router_settings;
 }
 
 
+void Serializer::SerializeRouterPartition()
+{
+	// Вспомогательные переменные
+	proto_serialization::RouterPartition proto_partition;
+
+	for (const auto& cells : tr_->GetPartition())
+	{
+		// Заполняем временые переменные данными (по порядку номеров остановок)
+		proto_serialization::StopCells* proto_stop_cells = proto_partition.add_stops();
+		for (const uint32_t cell : cells)
+		{
+			proto_stop_cells->add_cells(cell);
+		}
+	}
+
+	// Запоминаем в классовой прото-структуре
+	*proto_all_settings_.mutable_router_partition() = std::move(proto_partition);
+}
+
+
+void Serializer::SerializeNameIndexes()
+{
+	// Хэш-функции есть только у замороженного каталога
+	if (!tc_.IsFrozen())
+	{
+		return;
+	}
+	*proto_all_settings_.mutable_stops_index() = SerializeNameIndex(tc_.GetStopsIndexData());
+	*proto_all_settings_.mutable_routes_index() = SerializeNameIndex(tc_.GetRoutesIndexData());
+}
+
+
+proto_serialization::NameIndex Serializer::SerializeNameIndex(const transport_catalogue::PerfectHashData& data)
+{
+	proto_serialization::NameIndex proto_index;
+	proto_index.set_seed(data.seed);
+	proto_index.set_keys_count(data.keys_count);
+	for (const uint32_t displacement : data.displacements)
+	{
+		proto_index.add_displacements(displacement);
+	}
+	return proto_index;
+}
+
+
 void Serializer::DeserializeCatalogue()
 {
-	// 1. Восстанавливаем данные об остановках
+	// 1. Восстанавливаем данные об остановках. Порядок добавления восстанавливает их номера
 	for (int i = 0; i < proto_all_settings_.stops_size(); ++i)  // .stops().size()
 	{
-		proto_serialization::Stop proto_stop = proto_all_settings_.stops(i);
-		tc_.AddStop(transport_catalogue::Stop(proto_stop.name(), proto_stop.coords().lat(), proto_stop.coords().lng()));
+		const proto_serialization::Stop& proto_stop = proto_all_settings_.stops(i);
+		tc_.AddStop(proto_stop.name(), geo::Coordinates{ proto_stop.coords().lat(), proto_stop.coords().lng() },
+					proto_stop.is_boundary());
 	}
 
 	// 2. Восстанавливаем данные о расстояниях
 	for (int i = 0; i < proto_all_settings_.distances_size(); ++i)  // .distances().size()
 	{
-		transport_catalogue::StopPtr stop_from_ptr = tc_.GetStopByName(proto_all_settings_.distances(i).from());
-		transport_catalogue::StopPtr stop_to_ptr = tc_.GetStopByName(proto_all_settings_.distances(i).to());
-		size_t distance = proto_all_settings_.distances(i).distance();
-		tc_.AddDistance(stop_from_ptr, stop_to_ptr, distance);
+		const proto_serialization::Distance& proto_distance = proto_all_settings_.distances(i);
+		tc_.AddDistance(proto_distance.stop_from(), proto_distance.stop_to(), proto_distance.distance());
 	}
 
-	// 3. Восстанавливаем данные о маршрутах
+	// 3. Восстанавливаем регионы (в порядке номеров) и данные о маршрутах.
+	// В базе старого формата регионов нет - все маршруты попадают в регион по умолчанию
+	for (int i = 0; i < proto_all_settings_.region_names_size(); ++i)
+	{
+		tc_.AddRegion(proto_all_settings_.region_names(i));
+	}
 	for (int i = 0; i < proto_all_settings_.routes_size(); ++i)  // .routes().size()
 	{
 		// Текущий маршрут из классовой прото-структуры
-		proto_serialization::Route proto_route = proto_all_settings_.routes(i);
-		// Маршрут транспортного каталога
-		transport_catalogue::Route route;
-		
-		route.route_name = proto_route.route_name();
-		route.is_circular = proto_route.is_circular();
+		const proto_serialization::Route& proto_route = proto_all_settings_.routes(i);
+
+		// Маршрут сохранен так, как он задан. Номера остановок совпадают с номерами в каталоге
+		tc_.AddRoute(proto_route.route_name(),
+					 std::vector<transport_catalogue::StopId>(proto_route.stop_ids().begin(), proto_route.stop_ids().end()),
+					 proto_route.is_circular(),
+					 (static_cast<int>(proto_route.region()) < proto_all_settings_.region_names_size())
+						 ? std::string_view(proto_all_settings_.region_names(static_cast<int>(proto_route.region())))
+						 : std::string_view{});
+	}
 
-		// ВНИМАНИЕ! tc_.AddRoute() достраивает не круговой маршрут до кругового.
-		// Этот момент учитывается при сериализации, сохраняя лишь 1/2 маршрута.
-		// При десериализации никаких действий не требуется, 
-		// AddRoute() все сделает автоматически
+	// 4. Замораживаем каталог: после загрузки он только читается. Хэш-функции
+	// берем из базы, а для базы без них (или с устаревшими) строим заново
+	if (proto_all_settings_.has_stops_index() && proto_all_settings_.has_routes_index())
+	{
+		tc_.Freeze(DeserializeNameIndex(proto_all_settings_.stops_index()),
+				   DeserializeNameIndex(proto_all_settings_.routes_index()));
+	}
+	else
+	{
+		tc_.Freeze();
+	}
+}
 
-		// Поостановочно переносим маршрут из proto_route в route
-		for (const auto& proto_stop : proto_route.stops())
-		{
-			// Преобразуем прото-имя в указатель каталога
-			route.stops.push_back(tc_.GetStopByName(proto_stop.name()));
-		}
 
-		tc_.AddRoute(std::move(route));
-	}
+transport_catalogue::PerfectHashData Serializer::DeserializeNameIndex(const proto_serialization::NameIndex& proto_index)
+{
+	transport_catalogue::PerfectHashData data;
+	data.seed = proto_index.seed();
+	data.keys_count = proto_index.keys_count();
+	data.displacements.assign(proto_index.displacements().begin(), proto_index.displacements().end());
+	return data;
 }
 
 void Serializer::DeserializeRenderer()
@@ -48,9 +48,16 @@ private:
 	void SerializeRendererSettings();
 	// Сериализация message RouterSettings
 	void SerializeRouterSettings();
+	// Сериализация message RouterPartition
+	void SerializeRouterPartition();
+	// Сериализация message NameIndex для остановок и маршрутов
+	void SerializeNameIndexes();
+	proto_serialization::NameIndex SerializeNameIndex(const transport_catalogue::PerfectHashData& data);
 
 	// Десериализация каталога
 	void DeserializeCatalogue();
+	// Десериализация совершенной хэш-функции
+	transport_catalogue::PerfectHashData DeserializeNameIndex(const proto_serialization::NameIndex& proto_index);
 	// Десериализация рендерера
 	void DeserializeRenderer();
 	// Десериализация настроек рендеринга
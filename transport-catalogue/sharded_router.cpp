@@ -0,0 +1,432 @@
+#include "sharded_router.h"
+#include "transport_router.h"
+#include "parallel.h"    // для параллельного построения шардов
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace router
+{
+
+namespace
+{
+
+using transport_catalogue::RegionId;
+using transport_catalogue::RouteId;
+using transport_catalogue::StopId;
+
+// Отсутствующая вершина оверлея, ребро или шард
+const uint32_t NO_INDEX = UINT32_MAX;
+// Время до недостижимой вершины
+const double NO_TIME = std::numeric_limits<double>::infinity();
+
+// Название региона в сообщениях и отчетах
+std::string MakeRegionTitle(std::string_view region_name)
+{
+	return region_name.empty() ? std::string("(default)") : std::string(region_name);
+}
+
+} // namespace
+
+// ----------- ShardedRouter ---------------
+
+ShardedRouter::ShardedRouter(const transport_catalogue::FrozenCatalogue& tc, const RouterSettings& settings,
+							 size_t expected_route_queries, std::ostream* diagnostics /*= nullptr*/)
+{
+	const size_t stops_count = tc.GetStopsCount();
+
+	// 1. Регионы остановки - регионы проходящих через нее маршрутов
+	std::vector<std::pair<StopId, RegionId>> stop_regions;
+	for (RouteId route = 0; route < tc.GetRoutesCount(); ++route)
+	{
+		const RegionId region = tc.GetRouteRegion(route);
+		for (const StopId stop : tc.GetRouteStops(route))
+		{
+			stop_regions.emplace_back(stop, region);
+		}
+	}
+	std::sort(stop_regions.begin(), stop_regions.end());
+	stop_regions.erase(std::unique(stop_regions.begin(), stop_regions.end()), stop_regions.end());
+
+	// 2. Шард - регион, в котором есть маршруты с остановками. Шарды идут в порядке номеров регионов
+	std::vector<uint32_t> region_shards(tc.GetRegionsCount(), NO_INDEX);
+	for (const auto& [stop, region] : stop_regions)
+	{
+		region_shards[region] = 0;
+	}
+	for (RegionId region = 0; region < region_shards.size(); ++region)
+	{
+		if (region_shards[region] != NO_INDEX)
+		{
+			region_shards[region] = static_cast<uint32_t>(shards_.size());
+			Shard& shard = shards_.emplace_back();
+			shard.region = region;
+			shard.region_name = std::string(tc.GetRegionName(region));
+		}
+	}
+
+	// 3. Остановки шардов и вершины оверлея. Регионы одной остановки идут подряд
+	overlay_vertex_.assign(stops_count, NO_INDEX);
+	stop_shards_offsets_.assign(stops_count + 1, 0U);
+	stop_shards_.reserve(stop_regions.size());
+	for (size_t i = 0; i < stop_regions.size(); ++i)
+	{
+		const auto [stop, region] = stop_regions[i];
+		if (i > 0 && stop_regions[i - 1].first == stop && !tc.IsStopBoundary(stop))
+		{
+			throw std::runtime_error("Stop " + std::string(tc.GetStopName(stop)) + " is served by routes of regions "
+									 + MakeRegionTitle(tc.GetRegionName(stop_regions[i - 1].second)) + " and "
+									 + MakeRegionTitle(tc.GetRegionName(region)) + " but is not marked as boundary");
+		}
+		const uint32_t shard_index = region_shards[region];
+		Shard& shard = shards_[shard_index];
+		const StopId local = static_cast<StopId>(shard.stops.size());
+		shard.stops.push_back(stop);
+		stop_shards_.push_back({ shard_index, local });
+		++stop_shards_offsets_[stop + 1];
+		if (tc.IsStopBoundary(stop))
+		{
+			if (overlay_vertex_[stop] == NO_INDEX)
+			{
+				overlay_vertex_[stop] = static_cast<uint32_t>(overlay_stops_.size());
+				overlay_stops_.push_back(stop);
+			}
+			shard.boundary.push_back(local);
+		}
+	}
+	std::partial_sum(stop_shards_offsets_.begin(), stop_shards_offsets_.end(), stop_shards_offsets_.begin());
+
+	// 4. Шарды не зависят друг от друга - строим параллельно. Ребра оверлея каждый шард пишет в свой вектор
+	std::vector<std::vector<OverlayEdge>> shard_edges(shards_.size());
+	parallel::ForEachIndex(shards_.size(), 1, [&](size_t i)
+		{
+			BuildShard(tc, settings, expected_route_queries, static_cast<uint32_t>(i), shard_edges[i]);
+		});
+
+	// 5. Ребра оверлея в формате CSR по начальной вершине
+	overlay_offsets_.assign(overlay_stops_.size() + 1, 0U);
+	for (const auto& edges : shard_edges)
+	{
+		for (const OverlayEdge& edge : edges)
+		{
+			++overlay_offsets_[edge.from + 1];
+		}
+	}
+	std::partial_sum(overlay_offsets_.begin(), overlay_offsets_.end(), overlay_offsets_.begin());
+	overlay_edges_.resize(overlay_offsets_.back());
+	std::vector<uint32_t> fill(overlay_offsets_.begin(), overlay_offsets_.end() - 1);
+	for (const auto& edges : shard_edges)
+	{
+		for (const OverlayEdge& edge : edges)
+		{
+			overlay_edges_[fill[edge.from]++] = edge;
+		}
+	}
+
+	if (diagnostics)
+	{
+		*diagnostics << "router: sharded by regions: shards=" << shards_.size()
+			<< " boundary_stops=" << overlay_stops_.size()
+			<< " overlay_edges=" << overlay_edges_.size() << std::endl;
+	}
+}
+
+
+ShardedRouter::~ShardedRouter() = default;
+
+
+void ShardedRouter::BuildShard(const transport_catalogue::FrozenCatalogue& tc, const RouterSettings& settings,
+							   size_t expected_route_queries, uint32_t shard_index, std::vector<OverlayEdge>& edges)
+{
+	Shard& shard = shards_[shard_index];
+
+	// 1. Каталог региона: его остановки, расстояния между соседними остановками его маршрутов
+	// (в обе стороны, с учетом обратных расстояний общего каталога) и сами маршруты
+	shard.catalogue = std::make_unique<transport_catalogue::TransportCatalogue>();
+	for (const StopId stop : shard.stops)
+	{
+		shard.catalogue->AddStop(tc.GetStopName(stop), tc.GetStopCoordinates(stop), tc.IsStopBoundary(stop));
+	}
+	std::vector<StopId> route_stops;
+	for (RouteId route = 0; route < tc.GetRoutesCount(); ++route)
+	{
+		if (tc.GetRouteRegion(route) != shard.region)
+		{
+			continue;
+		}
+		const transport_catalogue::RouteTraversal stops = tc.GetRouteStops(route);
+		for (size_t i = 1; i < stops.size(); ++i)
+		{
+			shard.catalogue->AddDistance(GetLocalStop(shard_index, stops[i - 1]), GetLocalStop(shard_index, stops[i]),
+										 tc.GetDistance(stops[i - 1], stops[i]));
+		}
+		// Маршрут передается так, как он задан: без обратного направления некольцевого маршрута
+		const size_t defined_count = tc.IsRouteCircular(route) ? stops.size() : (stops.size() + 1) / 2;
+		route_stops.clear();
+		for (size_t i = 0; i < defined_count; ++i)
+		{
+			route_stops.push_back(GetLocalStop(shard_index, stops[i]));
+		}
+		shard.catalogue->AddRoute(tc.GetRouteName(route), route_stops, tc.IsRouteCircular(route));
+	}
+	shard.catalogue->Freeze();
+	shard.snapshot = std::make_unique<transport_catalogue::FrozenCatalogue>(*shard.catalogue);
+
+	// 2. Роутер региона. Алгоритм выбирается по размеру региона. Каждый запрос к сети
+	// спрашивает регион о времени до всех его пограничных остановок
+	shard.router = std::make_unique<TransportRouter>(*shard.snapshot);
+	RouterSettings shard_settings = settings;
+	shard.router->ApplyRouterSettings(shard_settings);
+	shard.router->SetExpectedRouteQueries(expected_route_queries * (shard.boundary.size() + 1));
+
+	// 3. Клика оверлея: время между всеми парами пограничных остановок региона
+	for (const StopId from : shard.boundary)
+	{
+		for (const StopId to : shard.boundary)
+		{
+			if (from == to)
+			{
+				continue;
+			}
+			if (const auto time = GetShardTime(shard_index, from, to))
+			{
+				edges.push_back({ overlay_vertex_[shard.stops[from]], overlay_vertex_[shard.stops[to]], *time, shard_index });
+			}
+		}
+	}
+}
+
+
+const ShardedRouter::StopShard* ShardedRouter::ShardsBegin(StopId stop) const
+{
+	return stop_shards_.data() + stop_shards_offsets_[stop];
+}
+
+
+const ShardedRouter::StopShard* ShardedRouter::ShardsEnd(StopId stop) const
+{
+	return stop_shards_.data() + stop_shards_offsets_[stop + 1];
+}
+
+
+StopId ShardedRouter::GetLocalStop(uint32_t shard, StopId stop) const
+{
+	// У остановки единицы шардов - ищем перебором
+	const StopShard* it = std::find_if(ShardsBegin(stop), ShardsEnd(stop), [shard](const StopShard& stop_shard)
+		{
+			return stop_shard.shard == shard;
+		});
+	if (it == ShardsEnd(stop))
+	{
+		throw std::logic_error("Stop doesn't belong to shard");
+	}
+	return it->local;
+}
+
+
+std::optional<double> ShardedRouter::GetShardTime(uint32_t shard, StopId from, StopId to)
+{
+	// Элементы пути не нужны - только время
+	const transport_catalogue::FrozenCatalogue& snapshot = *shards_[shard].snapshot;
+	return shards_[shard].router->VisitRoute(snapshot.GetStopName(from), snapshot.GetStopName(to), [](const RouteItem&) {});
+}
+
+
+void ShardedRouter::AddSegment(uint32_t shard, StopId from, StopId to)
+{
+	if (from == to)
+	{
+		return;
+	}
+	const transport_catalogue::FrozenCatalogue& snapshot = *shards_[shard].snapshot;
+	segments_.push_back({ shards_[shard].router.get(),
+						  snapshot.GetStopName(GetLocalStop(shard, from)),
+						  snapshot.GetStopName(GetLocalStop(shard, to)) });
+}
+
+
+void ShardedRouter::SearchOverlay()
+{
+	heap_.clear();
+	for (uint32_t vertex = 0; vertex < distances_.size(); ++vertex)
+	{
+		if (distances_[vertex] != NO_TIME)
+		{
+			heap_.emplace_back(distances_[vertex], vertex);
+		}
+	}
+	std::make_heap(heap_.begin(), heap_.end(), std::greater<>());
+	while (!heap_.empty())
+	{
+		std::pop_heap(heap_.begin(), heap_.end(), std::greater<>());
+		const auto [distance, vertex] = heap_.back();
+		heap_.pop_back();
+		if (distance > distances_[vertex])
+		{
+			continue;
+		}
+		for (uint32_t edge_id = overlay_offsets_[vertex]; edge_id < overlay_offsets_[vertex + 1]; ++edge_id)
+		{
+			const OverlayEdge& edge = overlay_edges_[edge_id];
+			if (distance + edge.time < distances_[edge.to])
+			{
+				distances_[edge.to] = distance + edge.time;
+				prev_edges_[edge.to] = edge_id;
+				heap_.emplace_back(distances_[edge.to], edge.to);
+				std::push_heap(heap_.begin(), heap_.end(), std::greater<>());
+			}
+		}
+	}
+}
+
+
+std::optional<double> ShardedRouter::FindRoute(StopId from, StopId to)
+{
+	segments_.clear();
+	if (from == to)
+	{
+		// Как и в графе всей сети: путь из остановки в нее же пуст
+		return 0.0;
+	}
+
+	double best_time = NO_TIME;
+	uint32_t direct_shard = NO_INDEX;    // Шард прямого пути, если он лучший
+	uint32_t exit_vertex = NO_INDEX;     // Иначе - последняя пограничная остановка пути
+	uint32_t exit_shard = NO_INDEX;      // и шард участка от нее до конечной остановки
+
+	// 1. Прямой путь внутри общего региона остановок
+	for (const StopShard* from_it = ShardsBegin(from); from_it != ShardsEnd(from); ++from_it)
+	{
+		for (const StopShard* to_it = ShardsBegin(to); to_it != ShardsEnd(to); ++to_it)
+		{
+			if (from_it->shard != to_it->shard)
+			{
+				continue;
+			}
+			const auto time = GetShardTime(from_it->shard, from_it->local, to_it->local);
+			if (time && *time < best_time)
+			{
+				best_time = *time;
+				direct_shard = from_it->shard;
+			}
+		}
+	}
+
+	// 2. Путь через пограничные остановки: до них в регионах начальной остановки,
+	// между ними по оверлею, от них до конечной в ее регионах
+	if (!overlay_stops_.empty())
+	{
+		distances_.assign(overlay_stops_.size(), NO_TIME);
+		entry_shards_.assign(overlay_stops_.size(), NO_INDEX);
+		prev_edges_.assign(overlay_stops_.size(), NO_INDEX);
+		for (const StopShard* from_it = ShardsBegin(from); from_it != ShardsEnd(from); ++from_it)
+		{
+			const Shard& shard = shards_[from_it->shard];
+			for (const StopId local : shard.boundary)
+			{
+				const uint32_t vertex = overlay_vertex_[shard.stops[local]];
+				const auto time = (local == from_it->local) ? std::optional<double>(0.0)
+					: GetShardTime(from_it->shard, from_it->local, local);
+				if (time && *time < distances_[vertex])
+				{
+					distances_[vertex] = *time;
+					entry_shards_[vertex] = from_it->shard;
+				}
+			}
+		}
+
+		SearchOverlay();
+
+		for (const StopShard* to_it = ShardsBegin(to); to_it != ShardsEnd(to); ++to_it)
+		{
+			const Shard& shard = shards_[to_it->shard];
+			for (const StopId local : shard.boundary)
+			{
+				const uint32_t vertex = overlay_vertex_[shard.stops[local]];
+				if (distances_[vertex] >= best_time)
+				{
+					// Участок до конечной остановки только увеличит время
+					continue;
+				}
+				const auto time = (local == to_it->local) ? std::optional<double>(0.0)
+					: GetShardTime(to_it->shard, local, to_it->local);
+				if (time && distances_[vertex] + *time < best_time)
+				{
+					best_time = distances_[vertex] + *time;
+					direct_shard = NO_INDEX;
+					exit_vertex = vertex;
+					exit_shard = to_it->shard;
+				}
+			}
+		}
+	}
+
+	if (best_time == NO_TIME)
+	{
+		return std::nullopt;
+	}
+
+	// 3. Участки пути. Путь через оверлей восстанавливается с конца
+	if (direct_shard != NO_INDEX)
+	{
+		AddSegment(direct_shard, from, to);
+		return best_time;
+	}
+	AddSegment(exit_shard, overlay_stops_[exit_vertex], to);
+	uint32_t vertex = exit_vertex;
+	while (prev_edges_[vertex] != NO_INDEX)
+	{
+		const OverlayEdge& edge = overlay_edges_[prev_edges_[vertex]];
+		AddSegment(edge.shard, overlay_stops_[edge.from], overlay_stops_[edge.to]);
+		vertex = edge.from;
+	}
+	AddSegment(entry_shards_[vertex], from, overlay_stops_[vertex]);
+	std::reverse(segments_.begin(), segments_.end());
+	return best_time;
+}
+
+
+const std::vector<ShardSegment>& ShardedRouter::GetSegments() const
+{
+	return segments_;
+}
+
+
+size_t ShardedRouter::GetShardsCount() const
+{
+	return shards_.size();
+}
+
+
+size_t ShardedRouter::GetOverlayStopsCount() const
+{
+	return overlay_stops_.size();
+}
+
+
+void ShardedRouter::ReportMemory(memory_report::MemoryReport& report)
+{
+	using namespace memory_report;
+	const std::string_view subsystem = "ShardedRouter";
+
+	// Подсистемы шарда учитываются одной строкой на регион
+	for (Shard& shard : shards_)
+	{
+		MemoryReport shard_report;
+		shard.catalogue->ReportMemory(shard_report);
+		shard.snapshot->ReportMemory(shard_report);
+		shard.router->ReportMemory(shard_report);
+		report.Add(subsystem, "region " + MakeRegionTitle(shard.region_name),
+				   shard_report.GetTotal() + VectorBytes(shard.stops) + VectorBytes(shard.boundary));
+	}
+	report.Add(subsystem, "stop_shards", VectorBytes(stop_shards_) + VectorBytes(stop_shards_offsets_));
+	report.Add(subsystem, "overlay", VectorBytes(overlay_stops_) + VectorBytes(overlay_vertex_)
+			   + VectorBytes(overlay_edges_) + VectorBytes(overlay_offsets_));
+	report.Add(subsystem, "query_buffers", VectorBytes(distances_) + VectorBytes(entry_shards_)
+			   + VectorBytes(prev_edges_) + VectorBytes(heap_) + VectorBytes(segments_));
+}
+
+}
@@ -0,0 +1,134 @@
+/*
+ * Назначение модуля: поиск маршрутов в сети из нескольких регионов (городов и пригородов),
+ * связанных немногими пересадочными остановками.
+ *
+ * Каждый регион - отдельный шард: собственный каталог (маршруты региона, их остановки и
+ * расстояния между ними), его снимок и TransportRouter, алгоритм которого выбирается по
+ * размеру региона, а не всей сети. Маршрут принадлежит одному региону, поэтому любой путь
+ * по сети делится на участки внутри регионов, стыкующиеся на пограничных остановках -
+ * остановках, через которые идут маршруты нескольких регионов. Такие остановки отмечаются
+ * во входных данных явно.
+ *
+ * Оверлей - граф на пограничных остановках: внутри каждого региона все пары его пограничных
+ * остановок соединены ребрами со временем пути, найденным роутером региона. Запрос из s в t:
+ * времена от s до пограничных остановок регионов s, поиск Дейкстры по оверлею, времена от
+ * пограничных остановок регионов t до t и прямой путь, если s и t лежат в одном регионе.
+ * Найденный путь раскрывается в элементы роутерами регионов его участков, так что запрос
+ * обращается только к шардам регионов s и t и регионов, через которые проходит путь.
+ * Пересадка на пограничной остановке стоит одного ожидания, как и любая пересадка в графе
+ * всей сети, поэтому время пути совпадает с поиском по общему графу.
+ */
+
+#pragma once
+
+#include "frozen_catalogue.h"
+#include "memory_report.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace router
+{
+
+class TransportRouter;
+struct RouterSettings;
+
+// Участок пути внутри одного региона
+struct ShardSegment
+{
+	TransportRouter* router = nullptr;    // Роутер региона участка
+	std::string_view from;                // Названия остановок (в снимке региона)
+	std::string_view to;
+};
+
+// ----------- ShardedRouter ---------------
+
+class ShardedRouter
+{
+public:
+	// Строит шарды регионов (параллельно) и оверлей по пограничным остановкам.
+	// Бросает std::runtime_error, если остановку обслуживают маршруты нескольких регионов,
+	// а пограничной она не отмечена. diagnostics - поток для сводки о шардах (nullptr - не выводить);
+	// роутеры регионов диагностику не выводят
+	ShardedRouter(const transport_catalogue::FrozenCatalogue&, const RouterSettings&, size_t expected_route_queries,
+				  std::ostream* diagnostics = nullptr);
+	~ShardedRouter();
+
+	// Ищет путь между остановками (номера в общем каталоге) и записывает его участки
+	// в буфер GetSegments(). Возвращает время в пути или nullopt, если пути нет
+	std::optional<double> FindRoute(transport_catalogue::StopId from, transport_catalogue::StopId to);
+	// Участки последнего найденного пути по порядку следования
+	const std::vector<ShardSegment>& GetSegments() const;
+
+	size_t GetShardsCount() const;
+	size_t GetOverlayStopsCount() const;
+
+	// Добавляет в отчет память шардов (по регионам) и оверлея
+	void ReportMemory(memory_report::MemoryReport&);
+
+private:
+	struct Shard
+	{
+		transport_catalogue::RegionId region = 0;
+		std::string region_name;
+		std::unique_ptr<transport_catalogue::TransportCatalogue> catalogue;
+		std::unique_ptr<transport_catalogue::FrozenCatalogue> snapshot;
+		std::unique_ptr<TransportRouter> router;
+		std::vector<transport_catalogue::StopId> stops;        // Номера остановок шарда в общем каталоге (номер в шарде - позиция)
+		std::vector<uint32_t> boundary;                         // Номера в шарде пограничных остановок
+	};
+	// Остановка общего каталога в шарде
+	struct StopShard
+	{
+		uint32_t shard = 0;
+		transport_catalogue::StopId local = 0;
+	};
+	// Ребро оверлея: путь внутри региона шарда между пограничными остановками
+	struct OverlayEdge
+	{
+		uint32_t from = 0;          // Вершины оверлея
+		uint32_t to = 0;
+		double time = 0.0;
+		uint32_t shard = 0;
+	};
+
+	// Заполняет каталог, снимок и роутер шарда и считает ребра оверлея внутри его региона
+	void BuildShard(const transport_catalogue::FrozenCatalogue&, const RouterSettings&,
+					size_t expected_route_queries, uint32_t shard, std::vector<OverlayEdge>&);
+	// Остановки общего каталога в шардах: [stop_shards_offsets_[s], stop_shards_offsets_[s + 1])
+	const StopShard* ShardsBegin(transport_catalogue::StopId) const;
+	const StopShard* ShardsEnd(transport_catalogue::StopId) const;
+	// Номер в шарде остановки общего каталога (остановка должна принадлежать шарду)
+	transport_catalogue::StopId GetLocalStop(uint32_t shard, transport_catalogue::StopId) const;
+	// Время пути внутри шарда (остановки - номера в шарде). nullopt - пути нет
+	std::optional<double> GetShardTime(uint32_t shard, transport_catalogue::StopId from, transport_catalogue::StopId to);
+	// Дописывает участок пути (остановки - номера в общем каталоге). Пустой участок пропускается
+	void AddSegment(uint32_t shard, transport_catalogue::StopId from, transport_catalogue::StopId to);
+	// Дейкстра по оверлею от уже заполненных расстояний до вершин
+	void SearchOverlay();
+
+	std::vector<Shard> shards_;
+	std::vector<StopShard> stop_shards_;
+	std::vector<uint32_t> stop_shards_offsets_;
+
+	// Оверлей: вершина - пограничная остановка, ребра вершины v - [overlay_offsets_[v], overlay_offsets_[v + 1])
+	std::vector<transport_catalogue::StopId> overlay_stops_;
+	std::vector<uint32_t> overlay_vertex_;     // Вершина оверлея по номеру остановки (NO_VERTEX - не пограничная)
+	std::vector<OverlayEdge> overlay_edges_;
+	std::vector<uint32_t> overlay_offsets_;
+
+	// Буферы запроса (переиспользуются между запросами)
+	std::vector<double> distances_;            // Время от начальной остановки до вершины оверлея
+	std::vector<uint32_t> entry_shards_;       // Шард участка от начальной остановки до вершины (если вершина начальная)
+	std::vector<uint32_t> prev_edges_;         // Ребро, которым достигнута вершина
+	std::vector<std::pair<double, uint32_t>> heap_;    // Очередь вершин поиска по оверлею
+	std::vector<ShardSegment> segments_;
+};
+
+}
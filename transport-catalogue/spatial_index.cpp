@@ -0,0 +1,231 @@
+#define _USE_MATH_DEFINES  // Для константы Пи
+
+#include "spatial_index.h"
+#include "memory_report.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace geo
+{
+
+namespace
+{
+
+const double DEG_TO_RAD = M_PI / 180.;
+
+// Порядок кандидатов: по квадрату хорды, при равенстве - по номеру точки
+using Candidate = std::pair<double, uint32_t>;
+
+} // namespace
+
+// ----------- SpatialIndex ---------------
+
+SpatialIndex::SpatialIndex(const CoordinatesArray& points)
+{
+    nodes_.resize(points.Size());
+    for (size_t i = 0; i < points.Size(); ++i)
+    {
+        const Vector v = ToVector(points.Get(i));
+        std::copy(v.xyz, v.xyz + 3, nodes_[i].xyz);
+        nodes_[i].index = static_cast<uint32_t>(i);
+    }
+    Build(0, nodes_.size());
+}
+
+
+size_t SpatialIndex::Size() const
+{
+    return nodes_.size();
+}
+
+
+size_t SpatialIndex::GetMemoryUsage() const
+{
+    return memory_report::VectorBytes(nodes_);
+}
+
+
+SpatialIndex::Vector SpatialIndex::ToVector(Coordinates coords)
+{
+    const double lat = coords.lat * DEG_TO_RAD;
+    const double lng = coords.lng * DEG_TO_RAD;
+    return Vector{ { std::cos(lat) * std::cos(lng), std::cos(lat) * std::sin(lng), std::sin(lat) } };
+}
+
+
+double SpatialIndex::ChordSquared(const double* lhs, const double* rhs)
+{
+    const double dx = lhs[0] - rhs[0];
+    const double dy = lhs[1] - rhs[1];
+    const double dz = lhs[2] - rhs[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+
+double SpatialIndex::ChordToDistance(double chord_squared)
+{
+    // Центральный угол по хорде единичной сферы. asin хорошо обусловлен на малых углах,
+    // в отличие от acos в ComputeDistance
+    const double half_chord = std::min(std::sqrt(chord_squared) / 2.0, 1.0);
+    return 2.0 * std::asin(half_chord) * EARTH_RADIUS;
+}
+
+
+void SpatialIndex::Build(size_t lo, size_t hi)
+{
+    if (hi - lo <= 1)
+    {
+        return;
+    }
+    // Делим по оси с наибольшим разбросом - дерево остается сбалансированным по форме
+    double min_xyz[3] = { 2.0, 2.0, 2.0 };
+    double max_xyz[3] = { -2.0, -2.0, -2.0 };
+    for (size_t i = lo; i < hi; ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            min_xyz[axis] = std::min(min_xyz[axis], nodes_[i].xyz[axis]);
+            max_xyz[axis] = std::max(max_xyz[axis], nodes_[i].xyz[axis]);
+        }
+    }
+    uint8_t split_axis = 0;
+    for (uint8_t axis = 1; axis < 3; ++axis)
+    {
+        if (max_xyz[axis] - min_xyz[axis] > max_xyz[split_axis] - min_xyz[split_axis])
+        {
+            split_axis = axis;
+        }
+    }
+
+    const size_t mid = lo + (hi - lo) / 2;
+    std::nth_element(nodes_.begin() + lo, nodes_.begin() + mid, nodes_.begin() + hi,
+                     [split_axis](const Node& lhs, const Node& rhs)
+                     {
+                         return lhs.xyz[split_axis] < rhs.xyz[split_axis];
+                     });
+    nodes_[mid].axis = split_axis;
+    Build(lo, mid);
+    Build(mid + 1, hi);
+}
+
+
+void SpatialIndex::SearchNearest(size_t lo, size_t hi, const Vector& center, size_t count,
+                                 std::vector<Candidate>& best) const
+{
+    if (lo >= hi)
+    {
+        return;
+    }
+    const size_t mid = lo + (hi - lo) / 2;
+    const Node& node = nodes_[mid];
+
+    const Candidate candidate{ ChordSquared(node.xyz, center.xyz), node.index };
+    if (best.size() < count)
+    {
+        best.push_back(candidate);
+        std::push_heap(best.begin(), best.end());
+    }
+    else if (candidate < best.front())
+    {
+        std::pop_heap(best.begin(), best.end());
+        best.back() = candidate;
+        std::push_heap(best.begin(), best.end());
+    }
+
+    // Сначала поддерево со стороны центра, затем дальнее - если плоскость деления ближе худшего кандидата
+    const double diff = center.xyz[node.axis] - node.xyz[node.axis];
+    const bool left_first = diff < 0.0;
+    if (left_first)
+    {
+        SearchNearest(lo, mid, center, count, best);
+    }
+    else
+    {
+        SearchNearest(mid + 1, hi, center, count, best);
+    }
+    if (best.size() < count || diff * diff <= best.front().first)
+    {
+        if (left_first)
+        {
+            SearchNearest(mid + 1, hi, center, count, best);
+        }
+        else
+        {
+            SearchNearest(lo, mid, center, count, best);
+        }
+    }
+}
+
+
+void SpatialIndex::SearchInRadius(size_t lo, size_t hi, const Vector& center, double max_chord_squared,
+                                  std::vector<Candidate>& found) const
+{
+    if (lo >= hi)
+    {
+        return;
+    }
+    const size_t mid = lo + (hi - lo) / 2;
+    const Node& node = nodes_[mid];
+
+    const double chord_squared = ChordSquared(node.xyz, center.xyz);
+    if (chord_squared <= max_chord_squared)
+    {
+        found.emplace_back(chord_squared, node.index);
+    }
+
+    // Поддерево за плоскостью деления посещаем, только если плоскость пересекает шар поиска
+    const double diff = center.xyz[node.axis] - node.xyz[node.axis];
+    if (diff < 0.0 || diff * diff <= max_chord_squared)
+    {
+        SearchInRadius(lo, mid, center, max_chord_squared, found);
+    }
+    if (diff >= 0.0 || diff * diff <= max_chord_squared)
+    {
+        SearchInRadius(mid + 1, hi, center, max_chord_squared, found);
+    }
+}
+
+
+std::vector<NearbyPoint> SpatialIndex::MakeResult(std::vector<Candidate>& found)
+{
+    std::sort(found.begin(), found.end());
+    std::vector<NearbyPoint> result;
+    result.reserve(found.size());
+    for (const auto& [chord_squared, index] : found)
+    {
+        result.push_back({ index, ChordToDistance(chord_squared) });
+    }
+    return result;
+}
+
+
+std::vector<NearbyPoint> SpatialIndex::FindNearest(Coordinates center, size_t count) const
+{
+    if (count == 0)
+    {
+        return {};
+    }
+    std::vector<Candidate> best;
+    best.reserve(std::min(count, nodes_.size()));
+    SearchNearest(0, nodes_.size(), ToVector(center), count, best);
+    return MakeResult(best);
+}
+
+
+std::vector<NearbyPoint> SpatialIndex::FindInRadius(Coordinates center, double radius) const
+{
+    if (radius < 0.0)
+    {
+        return {};
+    }
+    // Хорда, соответствующая дуге radius. Дуга длиннее половины окружности захватывает всю сферу
+    const double angle = std::min(radius / EARTH_RADIUS, M_PI);
+    const double max_chord = 2.0 * std::sin(angle / 2.0);
+
+    std::vector<Candidate> found;
+    SearchInRadius(0, nodes_.size(), ToVector(center), max_chord * max_chord, found);
+    return MakeResult(found);
+}
+
+}  // namespace geo
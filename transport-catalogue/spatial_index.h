@@ -0,0 +1,80 @@
+/*
+ * Назначение модуля: пространственный индекс точек для поиска ближайших точек и точек в радиусе.
+ *
+ * Точки переводятся в единичные векторы трехмерного пространства (центр Земли - начало
+ * координат). Длина хорды между векторами монотонно растет вместе с расстоянием по
+ * поверхности, поэтому поиск по хорде дает точный результат без искажений проекции
+ * (у полюсов, на линии перемены дат). Векторы хранятся в неявном KD-дереве: дерево
+ * отрезка [lo, hi) - его середина и деревья [lo, mid) и [mid + 1, hi), ось деления
+ * выбирается по наибольшему разбросу. Поиск k ближайших и поиск в радиусе отсекают
+ * поддеревья, которые не могут улучшить ответ, и на равномерных данных обходят
+ * O(log n + k) узлов.
+ */
+
+#pragma once
+
+#include "geo.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace geo
+{
+
+// Точка из индекса и расстояние до нее по поверхности, метров
+struct NearbyPoint
+{
+    uint32_t index = 0;       // Номер точки в исходном массиве координат
+    double distance = 0.0;
+};
+
+// ----------- SpatialIndex ---------------
+
+class SpatialIndex
+{
+public:
+    SpatialIndex() = default;
+    // Строит индекс по всем точкам массива, номера точек - их номера в массиве
+    explicit SpatialIndex(const CoordinatesArray& points);
+
+    // Не более count ближайших к center точек в порядке возрастания расстояния
+    // (при равных расстояниях - в порядке номеров)
+    std::vector<NearbyPoint> FindNearest(Coordinates center, size_t count) const;
+    // Все точки не дальше radius метров от center в порядке возрастания расстояния
+    std::vector<NearbyPoint> FindInRadius(Coordinates center, double radius) const;
+
+    size_t Size() const;
+    // Динамическая память дерева, байт
+    size_t GetMemoryUsage() const;
+
+private:
+    struct Node
+    {
+        double xyz[3];         // Единичный вектор точки
+        uint32_t index = 0;    // Номер точки в исходном массиве
+        uint8_t axis = 0;      // Ось деления поддерева с корнем в этом узле
+    };
+    struct Vector
+    {
+        double xyz[3];
+    };
+
+    static Vector ToVector(Coordinates coords);
+    static double ChordSquared(const double* lhs, const double* rhs);
+    // Расстояние по поверхности по квадрату хорды
+    static double ChordToDistance(double chord_squared);
+
+    void Build(size_t lo, size_t hi);
+    // Поиск k ближайших. best - куча по убыванию (квадрат хорды, номер), не больше count элементов
+    void SearchNearest(size_t lo, size_t hi, const Vector& center, size_t count,
+                       std::vector<std::pair<double, uint32_t>>& best) const;
+    void SearchInRadius(size_t lo, size_t hi, const Vector& center, double max_chord_squared,
+                        std::vector<std::pair<double, uint32_t>>& found) const;
+    static std::vector<NearbyPoint> MakeResult(std::vector<std::pair<double, uint32_t>>& found);
+
+    std::vector<Node> nodes_;
+};
+
+}  // namespace geo
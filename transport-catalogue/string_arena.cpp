@@ -0,0 +1,88 @@
+#include "string_arena.h"
+#include "memory_report.h"
+
+#include <cstring>
+
+namespace transport_catalogue
+{
+
+// ----------- InternedString ---------------
+
+bool operator==(InternedString lhs, InternedString rhs)
+{
+	const std::string_view lhs_view = lhs;
+	const std::string_view rhs_view = rhs;
+	// Строки одной арены уникальны: совпадение указателей означает равенство
+	return (lhs_view.data() == rhs_view.data() && lhs_view.size() == rhs_view.size()) || lhs_view == rhs_view;
+}
+
+bool operator!=(InternedString lhs, InternedString rhs)
+{
+	return !(lhs == rhs);
+}
+
+bool operator<(InternedString lhs, InternedString rhs)
+{
+	return lhs.View() < rhs.View();
+}
+
+// ----------- StringArena ---------------
+
+InternedString StringArena::Intern(std::string_view str)
+{
+	if (const auto it = index_.find(str); it != index_.end())
+	{
+		return InternedString(it->data(), it->size());
+	}
+
+	char* place = nullptr;
+	if (str.size() > BLOCK_SIZE / 4)
+	{
+		// Длинная строка получает собственный блок, чтобы не оставлять пустые хвосты
+		blocks_.push_back(std::make_unique<char[]>(str.size()));
+		bytes_reserved_ += str.size();
+		place = blocks_.back().get();
+	}
+	else
+	{
+		if (str.size() > block_free_)
+		{
+			blocks_.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+			bytes_reserved_ += BLOCK_SIZE;
+			block_pos_ = blocks_.back().get();
+			block_free_ = BLOCK_SIZE;
+		}
+		place = block_pos_;
+		block_pos_ += str.size();
+		block_free_ -= str.size();
+	}
+
+	if (!str.empty())
+	{
+		std::memcpy(place, str.data(), str.size());
+	}
+	bytes_used_ += str.size();
+	const std::string_view stored(place, str.size());
+	index_.insert(stored);
+	return InternedString(stored.data(), stored.size());
+}
+
+
+size_t StringArena::GetBytesUsed() const
+{
+	return bytes_used_;
+}
+
+
+size_t StringArena::GetBytesReserved() const
+{
+	return bytes_reserved_;
+}
+
+
+size_t StringArena::GetMemoryUsage() const
+{
+	return bytes_reserved_ + memory_report::VectorBytes(blocks_) + memory_report::HashTableBytes(index_);
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Назначение модуля: арена строк для названий остановок и маршрутов.
+ *
+ * Каждое название хранится ровно один раз в непрерывных блоках памяти, принадлежащих
+ * арене (каталогу). Вместо копий строк подсистемы хранят дескрипторы InternedString,
+ * которые не владеют памятью и приводятся к string_view. Дескрипторы одной и той же
+ * строки указывают на одни и те же байты, поэтому сравнение на равенство начинается
+ * со сравнения указателей.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace transport_catalogue
+{
+
+// ----------- InternedString ---------------
+
+// Дескриптор строки в арене. Действителен, пока жива арена, выдавшая его
+class InternedString
+{
+public:
+	InternedString() = default;
+
+	operator std::string_view() const
+	{
+		return { data_, size_ };
+	}
+	std::string_view View() const
+	{
+		return { data_, size_ };
+	}
+	size_t size() const
+	{
+		return size_;
+	}
+	bool empty() const
+	{
+		return size_ == 0;
+	}
+
+private:
+	friend class StringArena;
+	InternedString(const char* data, size_t size) : data_(data), size_(size)
+	{}
+
+	const char* data_ = "";
+	size_t size_ = 0;
+};
+
+bool operator==(InternedString, InternedString);
+bool operator!=(InternedString, InternedString);
+bool operator<(InternedString, InternedString);
+
+// ----------- StringArena ---------------
+
+class StringArena
+{
+public:
+	StringArena() = default;
+	// Дескрипторы указывают внутрь блоков арены - копирование запрещено,
+	// перемещение сохраняет блоки (и дескрипторы) на месте
+	StringArena(const StringArena&) = delete;
+	StringArena& operator=(const StringArena&) = delete;
+	StringArena(StringArena&&) = default;
+	StringArena& operator=(StringArena&&) = default;
+
+	// Возвращает дескриптор строки, размещая ее в арене при первом обращении
+	InternedString Intern(std::string_view);
+
+	// Количество байт, занятых строками (без учета незаполненных хвостов блоков)
+	size_t GetBytesUsed() const;
+	// Количество байт, выделенных под блоки
+	size_t GetBytesReserved() const;
+	// Динамическая память арены: блоки, список блоков и индекс размещенных строк
+	size_t GetMemoryUsage() const;
+
+private:
+	static constexpr size_t BLOCK_SIZE = 64 * 1024;    // Размер обычного блока, байт
+
+	std::vector<std::unique_ptr<char[]>> blocks_;      // Блоки памяти со строками
+	size_t block_free_ = 0;                            // Свободно байт в текущем обычном блоке
+	char* block_pos_ = nullptr;                        // Начало свободного места в текущем обычном блоке
+	size_t bytes_used_ = 0;
+	size_t bytes_reserved_ = 0;
+	std::unordered_set<std::string_view> index_;       // Уже размещенные строки (указывают в блоки)
+};
+
+}
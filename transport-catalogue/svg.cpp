@@ -98,6 +98,11 @@ Polyline& Polyline::AddPoint(Point point)
     return *this;
 }
 
+void Circle::ReportMemory(memory_report::MemoryReport& report) const
+{
+    report.Add("svg::Document"sv, "objects"sv, sizeof(Circle));
+}
+
 void Polyline::RenderObject(const RenderContext& context) const
 {
     auto& out = context.out;
@@ -191,6 +196,19 @@ std::string Text::Encode(std::string data) const
     return data;
 }
 
+void Polyline::ReportMemory(memory_report::MemoryReport& report) const
+{
+    report.Add("svg::Document"sv, "objects"sv, sizeof(Polyline));
+    report.Add("svg::Document"sv, "points"sv, memory_report::VectorBytes(points_));
+}
+
+void Text::ReportMemory(memory_report::MemoryReport& report) const
+{
+    using memory_report::StringBytes;
+    report.Add("svg::Document"sv, "objects"sv, sizeof(Text));
+    report.Add("svg::Document"sv, "texts"sv, StringBytes(font_family_) + StringBytes(font_weight_) + StringBytes(data_));
+}
+
 void Text::RenderObject(const RenderContext& context) const
 {
     auto& out = context.out;
@@ -230,4 +248,13 @@ void Document::Render(std::ostream& out) const
     out << "</svg>"sv;
 }
 
+void Document::ReportMemory(memory_report::MemoryReport& report) const
+{
+    report.Add("svg::Document"sv, "objects"sv, memory_report::VectorBytes(objects_));
+    for (const auto& object : objects_)
+    {
+        object->ReportMemory(report);
+    }
+}
+
 }  // namespace svg
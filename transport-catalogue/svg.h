@@ -2,6 +2,8 @@
 
 // Проверка валидности изображений SVG: https://www.svgviewer.dev/
 
+#include "memory_report.h"
+
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -259,6 +261,8 @@ class Object
 {
 public:
     void Render(const RenderContext& context) const;
+    // Добавляет в отчет память объекта (сам объект и его данные в куче)
+    virtual void ReportMemory(memory_report::MemoryReport& report) const = 0;
 
     virtual ~Object() = default;
 
@@ -312,6 +316,7 @@ class Circle final : public Object, public PathProps<Circle>
 public:
     Circle& SetCenter(Point center);
     Circle& SetRadius(double radius);
+    void ReportMemory(memory_report::MemoryReport& report) const override;
 
 private:
     void RenderObject(const RenderContext& context) const override;
@@ -329,6 +334,7 @@ class Polyline final : public Object, public PathProps<Polyline>
 public:
     // Добавляет очередную вершину к ломаной линии
     Polyline& AddPoint(Point point);
+    void ReportMemory(memory_report::MemoryReport& report) const override;
 
     /*
      * Прочие методы и данные, необходимые для реализации элемента <polyline>
@@ -363,6 +369,8 @@ public:
     // Задаёт текстовое содержимое объекта (отображается внутри тега text)
     Text& SetData(std::string data);
 
+    void ReportMemory(memory_report::MemoryReport& report) const override;
+
     // Прочие данные и методы, необходимые для реализации элемента <text>
 private:
     std::string Encode(std::string data) const;
@@ -402,6 +410,9 @@ public:
     // Выводит в ostream svg-представление документа
     void Render(std::ostream& out) const;
 
+    // Добавляет в отчет память документа: объекты, точки ломаных, тексты
+    void ReportMemory(memory_report::MemoryReport& report) const;
+
     // Прочие методы и данные, необходимые для реализации класса Document
 private:
     std::vector<std::unique_ptr<Object>> objects_;
@@ -0,0 +1,165 @@
+/*
+ * Проверка публикации версий каталога: потоки-читатели захватывают снимки и держат их,
+ * пока писатель меняет каталог и публикует новые версии.
+ *
+ * Писатель на шаге i меняет сразу остановку и маршрут: широта остановки "S0" - i, маршрут
+ * "R" проходит через первые (i % STEP_STOPS + 2) остановки. Каждая версия должна быть
+ * согласованной (остановки маршрута соответствуют широте той же версии), а захваченная
+ * версия не должна меняться, сколько бы новых версий ни вышло.
+ */
+
+#include "../catalogue_versions.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace transport_catalogue;
+
+const size_t STOPS_COUNT = 64;
+const size_t STEP_STOPS = 16;
+const int STEPS = 500;
+const size_t READERS = 4;
+const size_t HELD_VERSIONS = 8;
+
+std::atomic<size_t> failures{ 0 };
+
+void Check(bool condition, const std::string& message)
+{
+	if (!condition)
+	{
+		if (failures.fetch_add(1) < 10)
+		{
+			std::cerr << "FAILED: " << message << std::endl;
+		}
+	}
+}
+
+std::string StopName(size_t index)
+{
+	return "S" + std::to_string(index);
+}
+
+// Количество остановок маршрута "R" на шаге писателя
+size_t RouteStopsAt(int step)
+{
+	return static_cast<size_t>(step) % STEP_STOPS + 2;
+}
+
+// Шаг писателя, на котором построена версия (по широте остановки "S0")
+int StepOf(const FrozenCatalogue& snapshot)
+{
+	const auto stop = snapshot.FindStop(StopName(0));
+	Check(stop.has_value(), "stop S0 is missing");
+	return stop ? static_cast<int>(snapshot.GetStopCoordinates(*stop).lat) : 0;
+}
+
+// Проверяет согласованность версии и возвращает ее шаг
+int CheckSnapshot(const FrozenCatalogue& snapshot)
+{
+	const int step = StepOf(snapshot);
+	Check(snapshot.GetStopsCount() == STOPS_COUNT, "stops count changed");
+	const auto route = snapshot.FindRoute("R");
+	Check(route.has_value(), "route R is missing");
+	if (!route)
+	{
+		return step;
+	}
+	const size_t expected = RouteStopsAt(step);
+	const RouteStatPtr stat = snapshot.GetRouteStat(*route);
+	Check(stat->stops_on_route == expected, "route R of step " + std::to_string(step) + " has "
+		  + std::to_string(stat->stops_on_route) + " stops instead of " + std::to_string(expected));
+	Check(snapshot.GetRouteStops(*route).size() == expected, "route R stops differ from its answer");
+	Check(snapshot.GetRouteInfo("R") == stat, "route R answer is not found by name");
+	return step;
+}
+
+} // namespace
+
+int main()
+{
+	TransportCatalogue tc;
+	for (size_t i = 0; i < STOPS_COUNT; ++i)
+	{
+		tc.AddStop(StopName(i), geo::Coordinates{ 0.0, 0.001 * static_cast<double>(i) });
+	}
+	std::vector<StopId> stops;
+	for (size_t i = 0; i < RouteStopsAt(0); ++i)
+	{
+		stops.push_back(static_cast<StopId>(i));
+	}
+	tc.AddRoute("R", stops, true);
+	tc.Freeze();
+
+	CatalogueVersions versions(tc);
+	std::atomic<bool> done{ false };
+
+	// Читатели: проверяют каждую захваченную версию и держат несколько последних,
+	// перепроверяя их после выхода новых версий
+	std::vector<std::thread> readers;
+	for (size_t r = 0; r < READERS; ++r)
+	{
+		readers.emplace_back([&versions, &done]()
+			{
+				std::vector<std::pair<FrozenCataloguePtr, int>> held;
+				uint64_t last_version = 0;
+				int last_step = 0;
+				while (!done.load())
+				{
+					const uint64_t version = versions.GetVersion();
+					FrozenCataloguePtr snapshot = versions.Acquire();
+					Check(version >= last_version, "version number decreased");
+					last_version = version;
+					const int step = CheckSnapshot(*snapshot);
+					Check(step >= last_step, "reader saw an older version after a newer one");
+					last_step = step;
+					for (const auto& [old_snapshot, old_step] : held)
+					{
+						Check(CheckSnapshot(*old_snapshot) == old_step, "held version changed");
+					}
+					if (held.size() == HELD_VERSIONS)
+					{
+						held.erase(held.begin());
+					}
+					held.emplace_back(std::move(snapshot), step);
+				}
+			});
+	}
+
+	// Писатель: каталог меняет только он, версии выходят одна за другой
+	for (int step = 1; step <= STEPS; ++step)
+	{
+		tc.UpdateStop(StopName(0), geo::Coordinates{ static_cast<double>(step), 0.0 });
+		stops.clear();
+		for (size_t i = 0; i < RouteStopsAt(step); ++i)
+		{
+			stops.push_back(static_cast<StopId>(i));
+		}
+		tc.UpdateRoute("R", stops, true);
+		const CatalogueChanges changes = versions.Publish();
+		Check(changes.Any(), "changes were not published");
+	}
+	Check(!versions.Publish().Any(), "empty publication changed the version");
+	done.store(true);
+	for (std::thread& reader : readers)
+	{
+		reader.join();
+	}
+
+	Check(versions.GetVersion() == static_cast<uint64_t>(STEPS) + 1, "wrong number of versions");
+	Check(StepOf(*versions.Acquire()) == STEPS, "last version is not current");
+
+	if (failures.load() != 0)
+	{
+		std::cerr << failures.load() << " check(s) failed" << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::cout << "catalogue_versions_test: OK" << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/*
+ * Проверка изменения остановок в режиме запросов: признак пограничной остановки меняется,
+ * только если он передан. Изменение одних координат не снимает признак и не перестраивает
+ * разбиение сети по регионам, а снять признак с остановки, через которую идут маршруты
+ * разных регионов, нельзя.
+ */
+
+#include "../transport_catalogue.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+using namespace transport_catalogue;
+
+size_t failures = 0;
+
+void Check(bool condition, const std::string& message)
+{
+	if (!condition)
+	{
+		++failures;
+		std::cerr << "FAILED: " << message << std::endl;
+	}
+}
+
+bool IsBoundary(const TransportCatalogue& tc, std::string_view name)
+{
+	return tc.GetStopByName(name)->is_boundary;
+}
+
+} // namespace
+
+int main()
+{
+	// "S1" - пересадка между регионами, "S0" отмечена пограничной, но ее обслуживает один регион
+	TransportCatalogue tc;
+	tc.AddStop("S0", geo::Coordinates{ 55.0, 37.0 }, true);
+	tc.AddStop("S1", geo::Coordinates{ 55.1, 37.1 }, true);
+	tc.AddStop("S2", geo::Coordinates{ 55.2, 37.2 });
+	tc.AddRoute("A", { 0, 1 }, false);
+	tc.AddRoute("B", { 1, 2 }, false, "east");
+	tc.Freeze();
+	tc.TakeChanges();
+
+	// 1. Только координаты пересадочной остановки
+	try
+	{
+		tc.UpdateStop("S1", geo::Coordinates{ 55.15, 37.15 });
+	}
+	catch (const std::invalid_argument& error)
+	{
+		Check(false, std::string("coordinate update of S1 rejected: ") + error.what());
+	}
+	CatalogueChanges changes = tc.TakeChanges();
+	Check(IsBoundary(tc, "S1"), "coordinate update cleared boundary flag of S1");
+	Check(changes.coordinates, "coordinate update of S1 is not recorded");
+	Check(!changes.regions, "coordinate update of S1 changed regions");
+	Check(tc.GetStopByName("S1")->coords.lat == 55.15, "coordinates of S1 are not updated");
+
+	// 2. Явное снятие признака с пересадочной остановки отклоняется без изменений
+	bool rejected = false;
+	try
+	{
+		tc.UpdateStop("S1", geo::Coordinates{ 55.3, 37.3 }, false);
+	}
+	catch (const std::invalid_argument&)
+	{
+		rejected = true;
+	}
+	Check(rejected, "clearing boundary flag of S1 is not rejected");
+	Check(IsBoundary(tc, "S1"), "rejected update changed S1");
+	Check(tc.GetStopByName("S1")->coords.lat == 55.15, "rejected update moved S1");
+	Check(!tc.TakeChanges().Any(), "rejected update recorded changes");
+
+	// 3. Остановку одного региона координаты тоже не меняют, явный признак - меняет
+	tc.UpdateStop("S0", geo::Coordinates{ 55.05, 37.05 });
+	Check(IsBoundary(tc, "S0"), "coordinate update cleared boundary flag of S0");
+	Check(!tc.TakeChanges().regions, "coordinate update of S0 changed regions");
+	tc.UpdateStop("S0", geo::Coordinates{ 55.05, 37.05 }, false);
+	Check(!IsBoundary(tc, "S0"), "boundary flag of S0 is not cleared");
+	Check(tc.TakeChanges().regions, "clearing boundary flag of S0 is not recorded");
+
+	// 4. Новая остановка без признака - не пограничная
+	tc.UpdateStop("S3", geo::Coordinates{ 55.4, 37.4 });
+	Check(!IsBoundary(tc, "S3"), "new stop is boundary");
+	tc.UpdateStop("S4", geo::Coordinates{ 55.5, 37.5 }, true);
+	Check(IsBoundary(tc, "S4"), "new boundary stop is not boundary");
+
+	if (failures != 0)
+	{
+		std::cerr << failures << " check(s) failed" << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::cout << "update_stop_test: OK" << std::endl;
+	return EXIT_SUCCESS;
+}
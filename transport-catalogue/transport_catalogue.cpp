@@ -1,13 +1,24 @@
 #include "transport_catalogue.h"
+#include "parallel.h"  // для расчета статистики маршрутов при пакетной загрузке
+
 #include <algorithm>   // для sort
+#include <stdexcept>   // для ошибок регионов
 
 namespace transport_catalogue
 {
 
+namespace
+{
+
+// Меньше маршрутов на поток не дают выигрыша от создания потоков
+const size_t BULK_ROUTES_PER_THREAD = 64;
+
+} // namespace
+
 // ----------- Секция типов для ответов на запросы---------------
 
-StopStat::StopStat(std::string_view stop_name, std::set<std::string_view>& buses) :
-	name(stop_name), buses(buses)
+StopStat::StopStat(std::string_view stop_name) :
+	name(stop_name)
 {}
 
 RouteStat::RouteStat(size_t stops, size_t unique_stops, int64_t meters_length, double curvature, std::string_view name) :
@@ -21,174 +32,553 @@ RouteStat::RouteStat(size_t stops, size_t unique_stops, int64_t meters_length, d
 // ----------- TransportCatalogue ---------------
 
 TransportCatalogue::TransportCatalogue()
-{}
+{
+	// Регион по умолчанию (без названия) есть всегда: в нем маршруты без явного региона
+	region_names_.emplace_back();
+}
 
 TransportCatalogue::~TransportCatalogue()
 {}
 
 // Добавляет остановку в словарь всех остановок
-void TransportCatalogue::AddStop(Stop&& stop)
+void TransportCatalogue::AddStop(std::string_view stop_name, geo::Coordinates coords, bool is_boundary /*= false*/)
 {
-	if (all_stops_map_.count(GetStopName(&stop)) == 0)
+	Thaw();
+	if (all_stops_map_.count(stop_name) == 0)
 	{
 		// Таких остановок в базе нет, добавлям
 
-		// 1. Добавляем остановку в дек-хранилище, перемещая stop
-		auto& ref = all_stops_data_.emplace_back(std::move(stop));
-		// 2. Добавляем остановку в словарь остановок
-		all_stops_map_.insert({ std::string_view(ref.name), &ref });
+		// 1. Добавляем остановку в дек-хранилище. Название - в арену, номер - позиция в деке
+		auto& ref = all_stops_data_.emplace_back(names_->Intern(stop_name), coords);
+		ref.id = static_cast<StopId>(all_stops_data_.size() - 1);
+		ref.is_boundary = is_boundary;
+		// 2. Добавляем остановку в словарь остановок (ключ указывает в арену)
+		all_stops_map_.insert({ ref.name.View(), ref.id });
+		stops_coords_.Add(coords);
+		stops_by_id_.push_back(&ref);
+		// 3. Заводим ответ на запрос об остановке. Маршруты добавит AddRoute()
+		stop_stats_.emplace_back(ref.name);
+		stop_buses_.emplace_back();
 	}
 }
 
 // Добавляет маршрут в словарь всех маршрутов
-void TransportCatalogue::AddRoute(Route&& route)
+void TransportCatalogue::AddRoute(std::string_view route_name, std::vector<StopId> stops, bool is_circular,
+								  std::string_view region /*= {}*/)
 {
+	Thaw();
 	// Отсутствует ли этот маршрут route в базе?
-	if (all_buses_map_.count(route.route_name) == 0)
+	if (all_buses_map_.count(route_name) == 0)
 	{
 		// Такого маршрута в базе нет, добавлям
 
-		/* Проверка отключена: в route передается vector<StopPtr>, то что они не
-		* ==nullptr будет проверять вызывающая функция, т.к. быстрее не добавить
-		* пустой указатель, чем потом проходить весь вектор в поисках пустых записей
+		/* Проверка отключена: в route передается vector<StopId>, то что они
+		* существуют будет проверять вызывающая функция, т.к. быстрее не добавить
+		* неверный номер, чем потом проходить весь вектор в поисках неверных записей
 		// 1 Проверяем существование остановок, несуществующие удаляем из route
-		route.stops.erase(std::remove_if(route.stops.begin(), route.stops.end(),
+		stops.erase(std::remove_if(stops.begin(), stops.end(),
 							[&](auto& x)
 							{
-								return (all_stops_map_.count(x->name) == 0);
+								return (x >= all_stops_data_.size());
 							}),
-						  route.stops.end());
+					stops.end());
 		*/
 
-		// 2. Добавляем маршрут (автобус) в дек-хранилище, перемещая route
-		auto& ref = all_buses_data_.emplace_back(std::move(route));
+		// Остановки копируются в память каталога: вектор вызывающего выделен в общей куче
+		Route& ref = EmplaceRoute(route_name, std::pmr::vector<StopId>(stops.begin(), stops.end(), &pool_), is_circular,
+								  AddRegion(region));
+		ComputeRouteStat(ref);
+		RegisterRouteStat(ref);
+	}
+}
 
-		// 3. Добавляем указатель на автобус (маршрут) из хранилища в словарь маршрутов
-		all_buses_map_.insert({ std::string_view(ref.route_name), &ref });
+// Пакетная загрузка остановок, расстояний и маршрутов
+void TransportCatalogue::AddBulk(const std::pmr::vector<StopDescription>& stops, const std::pmr::vector<RouteDescription>& routes)
+{
+	Thaw();
 
-		// 4. Подсчитываем уникальные остановки на маршруте
-		// Копируем вектор указателей
-		std::vector<StopPtr> tmp = ref.stops;
-		std::sort(tmp.begin(), tmp.end());
-		auto last = std::unique(tmp.begin(), tmp.end());
-		// Сохраняем количество уникальных остановок на маршруте
-		ref.unique_stops_qty = (last != tmp.end() ? std::distance(tmp.begin(), last) : tmp.size());
+	// 1. Резервируем память по количеству элементов и добавляем остановки
+	size_t distances_count = 0;
+	for (const auto& stop : stops)
+	{
+		distances_count += stop.road_distances.size();
+	}
+	all_stops_map_.reserve(all_stops_map_.size() + stops.size());
+	stops_by_id_.reserve(stops_by_id_.size() + stops.size());
+	stops_coords_.Reserve(stops_coords_.Size() + stops.size());
+	distances_.Reserve(distances_count);
+	for (const auto& stop : stops)
+	{
+		AddStop(stop.name, stop.coords, stop.is_boundary);
+	}
 
-		// 5. Если маршрут НЕ кольцевой, достраиваем обратный маршрут
-		if (!ref.is_circular)
+	// 2. Все остановки известны - добавляем расстояния
+	for (const auto& stop : stops)
+	{
+		const StopId from = all_stops_map_.at(stop.name);
+		for (const auto& [to_name, distance] : stop.road_distances)
 		{
-			// Достраиваем обратный маршрут для некольцевого маршрута
-			for (int i = ref.stops.size() - 2; i >= 0; --i)
+			if (const auto it = all_stops_map_.find(to_name); it != all_stops_map_.end())
 			{
-				// Добавляем в конец вектора остановки в обратном направлении, кроме конечной stops_list[size() - 1]
-				ref.stops.push_back(ref.stops[i]);
+				AddDistance(from, it->second, distance);
 			}
 		}
+	}
 
-		// 6. Подсчитываем длину маршрута
-		int stops_num = static_cast<int>(ref.stops.size());
-		if (stops_num > 1)
+	// 3. Размещаем маршруты последовательно: назначение номеров и словарь не параллелятся
+	all_buses_map_.reserve(all_buses_map_.size() + routes.size());
+	const size_t first_new_route = all_buses_data_.size();
+	for (const auto& route : routes)
+	{
+		if (all_buses_map_.count(route.name) != 0)
 		{
-			ref.geo_route_length = 0L;
-			ref.meters_route_length = 0U;
-			for (int i = 0; i < stops_num - 1; ++i)
+			continue;
+		}
+		std::pmr::vector<StopId> route_stops(&pool_);
+		route_stops.reserve(route.stops.size());
+		for (const std::string_view stop_name : route.stops)
+		{
+			if (const auto it = all_stops_map_.find(stop_name); it != all_stops_map_.end())
 			{
-				ref.geo_route_length += ComputeDistance(ref.stops[i]->coords, ref.stops[i + 1]->coords);
-				ref.meters_route_length += GetDistance(ref.stops[i], ref.stops[i + 1]);
+				route_stops.push_back(it->second);
 			}
-			// Рассчитываем кривизну маршрута
-			ref.curvature = ref.meters_route_length / ref.geo_route_length;
 		}
-		else
+		EmplaceRoute(route.name, std::move(route_stops), route.is_circular, AddRegion(route.region));
+	}
+
+	// 4. Непограничную остановку обслуживают маршруты одного региона: сеть делится на регионы
+	// по пограничным остановкам (см. ShardedRouter), нарушение обнаруживается до сохранения базы
+	std::vector<RegionId> stop_regions(all_stops_data_.size(), NO_REGION);
+	for (const Route& route : all_buses_data_)
+	{
+		for (const StopId stop : route.stops)
 		{
-			// У маршрута 0 или 1 остановка. Длина == 0
-			ref.geo_route_length = 0L;
-			ref.meters_route_length = 0U;
-			ref.curvature = 1L;
+			if (all_stops_data_[stop].is_boundary)
+			{
+				continue;
+			}
+			if (stop_regions[stop] != NO_REGION && stop_regions[stop] != route.region)
+			{
+				ThrowRegionConflict(stop, region_names_[route.region].View(), region_names_[stop_regions[stop]].View());
+			}
+			stop_regions[stop] = route.region;
 		}
 	}
+
+	// 5. Статистика маршрутов не зависит друг от друга - считаем параллельно
+	const size_t new_routes_count = all_buses_data_.size() - first_new_route;
+	parallel::ForEachIndex(new_routes_count, BULK_ROUTES_PER_THREAD, [this, first_new_route](size_t i)
+		{
+			ComputeRouteStat(all_buses_data_[first_new_route + i]);
+		});
+
+	// 6. Ответы сохраняются в порядке номеров
+	for (size_t id = first_new_route; id < all_buses_data_.size(); ++id)
+	{
+		RegisterRouteStat(all_buses_data_[id]);
+	}
 }
 
-// Добавляет расстояние между двумя остановками в словарь
-void TransportCatalogue::AddDistance(StopPtr stop_from, StopPtr stop_to, size_t dist)
+Route& TransportCatalogue::EmplaceRoute(std::string_view route_name, std::pmr::vector<StopId> stops, bool is_circular,
+										RegionId region)
+{
+	// 1. Добавляем маршрут (автобус) в дек-хранилище. Название - в арену, номер - позиция в деке.
+	// Вектор остановок переносится при создании записи: так он остается в памяти каталога
+	auto& ref = all_buses_data_.emplace_back(std::move(stops));
+	ref.route_name = names_->Intern(route_name);
+	ref.is_circular = is_circular;
+	ref.region = region;
+	ref.id = static_cast<RouteId>(all_buses_data_.size() - 1);
+
+	// 2. Добавляем номер автобуса (маршрута) в словарь маршрутов
+	all_buses_map_.insert({ ref.route_name.View(), ref.id });
+	routes_by_name_valid_ = false;
+
+	// Обратное направление некольцевого маршрута не хранится (см. RouteTraversal)
+	return ref;
+}
+
+void TransportCatalogue::ComputeRouteStat(Route& ref) const
 {
-	if (stop_from != nullptr && stop_to != nullptr)
+	// 1. Подсчитываем уникальные остановки на маршруте. Обратное направление
+	// некольцевого маршрута новых остановок не добавляет
+	std::vector<StopId> tmp(ref.stops.begin(), ref.stops.end());
+	std::sort(tmp.begin(), tmp.end());
+	ref.unique_stops_qty = std::distance(tmp.begin(), std::unique(tmp.begin(), tmp.end()));
+
+	// 2. Подсчитываем длину маршрута
+	const RouteTraversal traversal = ref.Traversal();
+	if (traversal.size() > 1)
+	{
+		// Географическая длина считается пакетно по массивам координат каталога. Расстояние
+		// по поверхности симметрично, поэтому обратный путь - те же отрезки в обратном порядке
+		std::vector<double> segments(ref.stops.size() - 1);
+		stops_coords_.ComputePathDistances(ref.stops.data(), ref.stops.size(), segments.data());
+		ref.geo_route_length = 0.;
+		for (const double segment : segments)
+		{
+			ref.geo_route_length += segment;
+		}
+		if (!ref.is_circular)
+		{
+			for (auto it = segments.rbegin(); it != segments.rend(); ++it)
+			{
+				ref.geo_route_length += *it;
+			}
+		}
+		// Дорожные расстояния в разные стороны могут различаться - проходим весь обход
+		ref.meters_route_length = 0U;
+		for (size_t i = 0; i + 1 < traversal.size(); ++i)
+		{
+			ref.meters_route_length += GetDistance(traversal[i], traversal[i + 1]);
+		}
+		// Рассчитываем кривизну маршрута
+		ref.curvature = ref.meters_route_length / ref.geo_route_length;
+	}
+	else
 	{
-		// Вносим запись в словарь расстояний
-		distances_map_.insert({ { stop_from, stop_to }, dist });
+		// У маршрута 0 или 1 остановка. Длина == 0
+		ref.geo_route_length = 0L;
+		ref.meters_route_length = 0U;
+		ref.curvature = 1L;
 	}
 }
 
-// Возвращает расстояние (size_t метры) между двумя остановками с перестановкой пары
-size_t TransportCatalogue::GetDistance(StopPtr stop_from, StopPtr stop_to)
+void TransportCatalogue::RegisterRouteStat(const Route& ref)
 {
-	size_t result = GetDistanceDirectly(stop_from, stop_to);
-	// Если прямого расстояния в словаре нет, возвращаем обратное расстояние, даже если оно 0
-	return (result > 0 ? result : GetDistanceDirectly(stop_to, stop_from));
+	// 1. Регистрируем маршрут в ответах для каждой его остановки, сохраняя сортировку
+	for (const StopId stop : ref.stops)
+	{
+		std::pmr::vector<std::string_view>& buses = stop_buses_[stop];
+		const auto it = std::lower_bound(buses.begin(), buses.end(), ref.route_name.View());
+		if (it == buses.end() || *it != ref.route_name.View())
+		{
+			buses.insert(it, ref.route_name.View());
+			// Вектор мог переехать - обновляем ссылку ответа
+			stop_stats_[stop].buses = BusesRange(buses.data(), buses.data() + buses.size());
+		}
+	}
+
+	// 2. Маршрут больше не меняется - сохраняем ответ на запрос о нем
+	StoreRouteStat(ref);
 }
 
-// Возвращает расстояние (size_t метры) между двумя остановками без перестановки пары
-size_t TransportCatalogue::GetDistanceDirectly(StopPtr stop_from, StopPtr stop_to)
+void TransportCatalogue::StoreRouteStat(const Route& ref)
 {
-	if (distances_map_.count({ stop_from, stop_to }) > 0)
+	RouteStat stat(ref.Traversal().size(),
+				   ref.unique_stops_qty,
+				   ref.meters_route_length,
+				   ref.curvature,
+				   ref.route_name);
+	if (ref.id < route_stats_.size())
 	{
-		return distances_map_.at({ stop_from, stop_to });
+		route_stats_[ref.id] = stat;
 	}
 	else
 	{
-		return 0U;
+		route_stats_.push_back(stat);
 	}
 }
 
+void TransportCatalogue::UnregisterRouteStops(const Route& ref)
+{
+	for (const StopId stop : ref.stops)
+	{
+		std::pmr::vector<std::string_view>& buses = stop_buses_[stop];
+		const auto it = std::lower_bound(buses.begin(), buses.end(), ref.route_name.View());
+		if (it != buses.end() && *it == ref.route_name.View())
+		{
+			buses.erase(it);
+			stop_stats_[stop].buses = BusesRange(buses.data(), buses.data() + buses.size());
+		}
+	}
+}
 
-std::string_view TransportCatalogue::GetStopName(StopPtr stop_ptr)
+void TransportCatalogue::RecomputeRoutesThrough(StopId stop)
 {
-	return std::string_view(stop_ptr->name);
+	// Список маршрутов остановки хранит названия - номера берем из словаря
+	for (const std::string_view bus : stop_buses_[stop])
+	{
+		Route& ref = all_buses_data_[all_buses_map_.at(bus)];
+		ComputeRouteStat(ref);
+		StoreRouteStat(ref);
+		changes_.changed_routes.push_back(ref.id);
+	}
 }
 
-std::string_view TransportCatalogue::GetStopName(const Stop stop)
+// Добавляет остановку или меняет координаты существующей
+void TransportCatalogue::UpdateStop(std::string_view stop_name, geo::Coordinates coords,
+									std::optional<bool> is_boundary /*= std::nullopt*/)
 {
-	return std::string_view(stop.name);
+	Thaw();
+	const auto it = all_stops_map_.find(stop_name);
+	if (it == all_stops_map_.end())
+	{
+		AddStop(stop_name, coords, is_boundary.value_or(false));
+		changes_.stops_added = true;
+		changes_.changed_stops.push_back(static_cast<StopId>(all_stops_data_.size() - 1));
+		return;
+	}
+
+	const StopId id = it->second;
+	if (is_boundary.has_value() && !*is_boundary && all_stops_data_[id].is_boundary)
+	{
+		// Снять признак можно, только если через остановку идут маршруты одного региона
+		const RegionId region = GetStopRegion(id);
+		for (const std::string_view bus : stop_buses_[id])
+		{
+			const RegionId other = all_buses_data_[all_buses_map_.at(bus)].region;
+			if (other != region)
+			{
+				ThrowRegionConflict(id, region_names_[region].View(), region_names_[other].View());
+			}
+		}
+	}
+	if (is_boundary && all_stops_data_[id].is_boundary != *is_boundary)
+	{
+		// Признак влияет только на разбиение сети по регионам, ответы не меняются
+		all_stops_data_[id].is_boundary = *is_boundary;
+		changes_.regions = true;
+	}
+	all_stops_data_[id].coords = coords;
+	stops_coords_.Set(id, coords);
+	changes_.changed_stops.push_back(id);
+	// Координаты влияют только на географическую длину (и кривизну) маршрутов через остановку
+	RecomputeRoutesThrough(id);
+	changes_.coordinates = true;
 }
 
-std::string_view TransportCatalogue::GetBusName(RoutePtr route_ptr)
+// Добавляет маршрут или заменяет остановки существующего
+void TransportCatalogue::UpdateRoute(std::string_view route_name, std::vector<StopId> stops, bool is_circular,
+									 std::string_view region /*= {}*/)
 {
-	return std::string_view(route_ptr->route_name);
+	Thaw();
+	// Регион маршрута должен совпадать с регионом других маршрутов через его непограничные
+	// остановки. Новый регион (еще не известный каталогу) не совпадает ни с одним
+	const RegionId region_id = FindRegion(region);
+	for (const StopId stop : stops)
+	{
+		if (all_stops_data_[stop].is_boundary)
+		{
+			continue;
+		}
+		const RegionId other = GetStopRegion(stop, route_name);
+		if (other != NO_REGION && other != region_id)
+		{
+			ThrowRegionConflict(stop, region, region_names_[other].View());
+		}
+	}
+
+	// Меняются списки маршрутов у прежних и новых остановок маршрута
+	changes_.changed_stops.insert(changes_.changed_stops.end(), stops.begin(), stops.end());
+	const auto it = all_buses_map_.find(route_name);
+	if (it == all_buses_map_.end())
+	{
+		AddRoute(route_name, std::move(stops), is_circular, region);
+		changes_.changed_routes.push_back(static_cast<RouteId>(all_buses_data_.size() - 1));
+	}
+	else
+	{
+		Route& ref = all_buses_data_[it->second];
+		changes_.changed_stops.insert(changes_.changed_stops.end(), ref.stops.begin(), ref.stops.end());
+		changes_.changed_routes.push_back(ref.id);
+		UnregisterRouteStops(ref);
+		// Копирование в существующий вектор сохраняет его источник памяти и емкость
+		ref.stops.assign(stops.begin(), stops.end());
+		ref.is_circular = is_circular;
+		ref.region = AddRegion(region);
+		ComputeRouteStat(ref);
+		RegisterRouteStat(ref);
+	}
+	changes_.routes = true;
+}
+
+// Удаляет маршрут, перенося последний маршрут на освободившийся номер
+bool TransportCatalogue::RemoveRoute(std::string_view route_name)
+{
+	Thaw();
+	const auto it = all_buses_map_.find(route_name);
+	if (it == all_buses_map_.end())
+	{
+		return false;
+	}
+	const RouteId id = it->second;
+	UnregisterRouteStops(all_buses_data_[id]);
+	all_buses_map_.erase(it);
+	changes_.changed_stops.insert(changes_.changed_stops.end(), all_buses_data_[id].stops.begin(),
+								  all_buses_data_[id].stops.end());
+
+	// Номера остаются плотными. Ответы об остановках хранят названия и не меняются.
+	// Название удаленного маршрута остается в арене до конца жизни каталога
+	const RouteId last = static_cast<RouteId>(all_buses_data_.size() - 1);
+	changes_.changed_routes.push_back(id);
+	changes_.changed_routes.push_back(last);
+	if (id != last)
+	{
+		all_buses_data_[id] = std::move(all_buses_data_[last]);
+		all_buses_data_[id].id = id;
+		all_buses_map_[all_buses_data_[id].route_name.View()] = id;
+		route_stats_[id] = route_stats_[last];
+	}
+	all_buses_data_.pop_back();
+	route_stats_.pop_back();
+	routes_by_name_valid_ = false;
+	changes_.routes = true;
+	return true;
+}
+
+// Задает расстояние между остановками, перезаписывая заданное ранее
+void TransportCatalogue::SetDistance(StopId stop_from, StopId stop_to, size_t dist)
+{
+	Thaw();
+	distances_.Set(stop_from, stop_to, dist);
+	// Расстояние используется только в маршрутах, проходящих через обе остановки
+	RecomputeRoutesThrough(stop_from);
+	if (stop_to != stop_from)
+	{
+		RecomputeRoutesThrough(stop_to);
+	}
+	changes_.distances = true;
+}
+
+RegionId TransportCatalogue::AddRegion(std::string_view region_name)
+{
+	if (const RegionId region = FindRegion(region_name); region != NO_REGION)
+	{
+		return region;
+	}
+	region_names_.push_back(names_->Intern(region_name));
+	return static_cast<RegionId>(region_names_.size() - 1);
+}
+
+RegionId TransportCatalogue::FindRegion(std::string_view region_name) const
+{
+	const auto it = std::find_if(region_names_.begin(), region_names_.end(), [region_name](const InternedString& name)
+		{
+			return name.View() == region_name;
+		});
+	return (it == region_names_.end()) ? NO_REGION : static_cast<RegionId>(it - region_names_.begin());
+}
+
+RegionId TransportCatalogue::GetStopRegion(StopId stop, std::string_view except /*= {}*/) const
+{
+	// Маршруты через непограничную остановку принадлежат одному региону - достаточно первого
+	for (const std::string_view bus : stop_buses_[stop])
+	{
+		if (bus != except)
+		{
+			return all_buses_data_[all_buses_map_.at(bus)].region;
+		}
+	}
+	return NO_REGION;
+}
+
+void TransportCatalogue::ThrowRegionConflict(StopId stop, std::string_view region, std::string_view other_region) const
+{
+	const auto title = [](std::string_view region_name)
+	{
+		return region_name.empty() ? std::string("(default)") : std::string(region_name);
+	};
+	throw std::invalid_argument("Stop " + std::string(all_stops_data_[stop].name.View()) + " is served by routes of regions "
+								+ title(other_region) + " and " + title(region) + " but is not marked as boundary");
+}
+
+CatalogueChanges TransportCatalogue::TakeChanges()
+{
+	return std::exchange(changes_, CatalogueChanges{});
 }
 
-std::string_view TransportCatalogue::GetBusName(const Route route)
+// Добавляет расстояние между двумя остановками в словарь
+void TransportCatalogue::AddDistance(StopId stop_from, StopId stop_to, size_t dist)
+{
+	// Вносим запись в хранилище расстояний
+	distances_.Add(stop_from, stop_to, dist);
+}
+
+// Возвращает расстояние (size_t метры) между двумя остановками с перестановкой пары
+size_t TransportCatalogue::GetDistance(StopId stop_from, StopId stop_to) const
+{
+	// Если прямого расстояния нет, хранилище вернет обратное расстояние, даже если оно 0.
+	// Оба направления лежат в одной записи - достаточно одного поиска
+	return distances_.Get(stop_from, stop_to);
+}
+
+// Возвращает расстояние (size_t метры) между двумя остановками без перестановки пары
+size_t TransportCatalogue::GetDistanceDirectly(StopId stop_from, StopId stop_to) const
+{
+	return distances_.GetDirectly(stop_from, stop_to);
+}
+
+
+std::string_view TransportCatalogue::GetStopName(StopPtr stop_ptr)
+{
+	return std::string_view(stop_ptr->name);
+}
+
+std::string_view TransportCatalogue::GetBusName(RoutePtr route_ptr)
 {
-	return std::string_view(route.route_name);
+	return std::string_view(route_ptr->route_name);
 }
 
 
 // Возвращает указатель на остановку по ее имени из словаря остановок
 StopPtr TransportCatalogue::GetStopByName(const std::string_view stop_name) const
 {
-	if (all_stops_map_.count(stop_name) == 0)
+	if (frozen_)
 	{
-		// Таких остановок в базе нет
-		return nullptr;
+		// Хэш-функция дает единственного кандидата, осталось сравнить название
+		const uint32_t id = stops_index_.FindCandidate(stop_name);
+		if (id == PerfectHashIndex::NO_ID || all_stops_data_[id].name != stop_name)
+		{
+			return nullptr;
+		}
+		return &all_stops_data_[id];
 	}
-	else
+
+	const auto it = all_stops_map_.find(stop_name);
+	if (it == all_stops_map_.end())
 	{
-		return all_stops_map_.at(stop_name);
+		// Таких остановок в базе нет
+		return nullptr;
 	}
+	return &all_stops_data_[it->second];
 }
 
 
 // Возвращает указатель на маршрут по его имени из словаря маршрутов
 RoutePtr TransportCatalogue::GetRouteByName(const std::string_view bus_name) const
 {
-	if (all_buses_map_.count(bus_name) == 0)
+	if (frozen_)
 	{
-		// Таких остановок в базе нет
-		return nullptr;
+		const uint32_t id = routes_index_.FindCandidate(bus_name);
+		if (id == PerfectHashIndex::NO_ID || all_buses_data_[id].route_name != bus_name)
+		{
+			return nullptr;
+		}
+		return &all_buses_data_[id];
 	}
-	else
+
+	const auto it = all_buses_map_.find(bus_name);
+	if (it == all_buses_map_.end())
 	{
-		return all_buses_map_.at(bus_name);
+		// Таких маршрутов в базе нет
+		return nullptr;
 	}
+	return &all_buses_data_[it->second];
+}
+
+
+// Возвращает указатель на остановку по ее номеру
+StopPtr TransportCatalogue::GetStop(StopId stop_id) const
+{
+	return &all_stops_data_[stop_id];
+}
+
+
+// Возвращает указатель на маршрут по его номеру
+RoutePtr TransportCatalogue::GetRoute(RouteId route_id) const
+{
+	return &all_buses_data_[route_id];
 }
 
 
@@ -203,12 +593,8 @@ RouteStatPtr TransportCatalogue::GetRouteInfo(const std::string_view route_name)
 		return nullptr;
 	}
 
-	// Маршрут с таким именем существует
-	return new RouteStat(ptr->stops.size(),
-						 ptr->unique_stops_qty,
-						 ptr->meters_route_length,
-						 ptr->curvature,
-						 ptr->route_name);
+	// Маршрут с таким именем существует. Ответ рассчитан при добавлении маршрута
+	return &route_stats_[ptr->id];
 }
 
 
@@ -223,88 +609,213 @@ StopStatPtr TransportCatalogue::GetBusesForStopInfo(const std::string_view stop_
 		return nullptr;
 	}
 
-	// Возможное улучшение: добавить обратный словарь stops_to_buses_map_ (если потребуется)
+	// Ответ заполнен в AddStop() / AddRoute(). Множество маршрутов может быть пустым,
+	// это валидный результат
+	return &stop_stats_[ptr->id];
+}
 
-	std::set<std::string_view> found_buses_sv;   // временное пустое множество найденных результатов (лексикографическая сортировка)
-	for (const auto& bus : all_buses_map_)
-	{
-		// Ищем в векторе остановок для текущего элемента цикла bus хоть 1 совпадение с заданной остановкой
-		auto tmp = std::find_if(bus.second->stops.begin(), bus.second->stops.end(),
-								[stop_name](StopPtr curr_stop)
-								{
-									return (curr_stop->name == stop_name);
-								});
-		if (tmp != bus.second->stops.end())
-		{
-			// Что-то найдено. Добавляем в вывод
-			found_buses_sv.insert(bus.second->route_name);
-		}
-	}
 
-	// Возвращаем результат, даже если множество пустое, это валидный результат
-	return new StopStat(stop_name, found_buses_sv);
+StopStatPtr TransportCatalogue::GetStopStat(StopId stop_id) const
+{
+	return &stop_stats_[stop_id];
 }
 
 
-void TransportCatalogue::GetAllRoutes(std::map<const std::string, RendererData>& all_routes) const
+RouteStatPtr TransportCatalogue::GetRouteStat(RouteId route_id) const
 {
+	return &route_stats_[route_id];
+}
 
-	for (const auto& route : all_buses_data_)
+
+size_t TransportCatalogue::GetAllStopsCount() const
+{
+	return all_stops_data_.size();
+}
+
+
+size_t TransportCatalogue::GetAllRoutesCount() const
+{
+	return all_buses_data_.size();
+}
+
+
+size_t TransportCatalogue::GetRegionsCount() const
+{
+	return region_names_.size();
+}
+
+
+std::string_view TransportCatalogue::GetRegionName(RegionId region) const
+{
+	return region_names_.at(region);
+}
+
+
+std::shared_ptr<const StringArena> TransportCatalogue::GetNamesArena() const
+{
+	return names_;
+}
+
+
+StopsPtrRange TransportCatalogue::GetAllStopsPtr() const
+{
+	return StopsPtrRange(stops_by_id_.data(), stops_by_id_.data() + stops_by_id_.size());
+}
+
+
+RoutesPtrRange TransportCatalogue::GetAllRoutesPtr() const
+{
+	if (!routes_by_name_valid_)
 	{
-		if (route.stops.size() > 0)
+		routes_by_name_.clear();
+		routes_by_name_.reserve(all_buses_data_.size());
+		for (const auto& route : all_buses_data_)
 		{
-			// Только для непустых маршрутов (пустые не участвуют в нормализации координат)
-			RendererData item;
-			for (StopPtr stop : route.stops)
-			{
-				item.stop_coords.push_back(stop->coords);
-				item.stop_names.push_back(stop->name);
-			}
-			item.is_circular = route.is_circular;
-
-			all_routes.emplace(make_pair(route.route_name, item));
+			routes_by_name_.push_back(&route);
 		}
+		// Названия маршрутов уникальны, строгое сравнение задает порядок без равных элементов
+		std::sort(routes_by_name_.begin(), routes_by_name_.end(), [](RoutePtr lhs, RoutePtr rhs)
+				  {
+					  return lhs->route_name < rhs->route_name;
+				  });
+		routes_by_name_valid_ = true;
 	}
+	return RoutesPtrRange(routes_by_name_.data(), routes_by_name_.data() + routes_by_name_.size());
+}
 
-	return;
+
+const DistanceStore& TransportCatalogue::GetAllDistances() const
+{
+	return distances_;
 }
 
 
-size_t TransportCatalogue::GetAllStopsCount() const
+const geo::CoordinatesArray& TransportCatalogue::GetStopsCoordinates() const
 {
-	return all_stops_data_.size();
+	return stops_coords_;
 }
 
 
-const std::vector<StopPtr> TransportCatalogue::GetAllStopsPtr() const
+namespace
 {
-	std::vector<StopPtr> stop_ptrs;
-	for (const auto& [stop_name, stop_ptr] : all_stops_map_)
+
+// Собирает названия элементов дека в порядке номеров
+template <typename Items, typename NameGetter>
+std::vector<std::string_view> CollectNames(const Items& items, NameGetter get_name)
+{
+	std::vector<std::string_view> names;
+	names.reserve(items.size());
+	for (const auto& item : items)
 	{
-		stop_ptrs.push_back(stop_ptr);
+		names.push_back(get_name(item));
 	}
-	return stop_ptrs;
+	return names;
 }
 
+std::string_view GetStopNameView(const Stop& stop)
+{
+	return stop.name;
+}
 
-const std::deque<RoutePtr> TransportCatalogue::GetAllRoutesPtr() const
+std::string_view GetRouteNameView(const Route& route)
 {
-	std::deque<RoutePtr> route_ptrs;
+	return route.route_name;
+}
+
+} // namespace
+
+
+void TransportCatalogue::Freeze()
+{
+	Thaw();
+	stops_index_ = PerfectHashIndex(CollectNames(all_stops_data_, GetStopNameView));
+	routes_index_ = PerfectHashIndex(CollectNames(all_buses_data_, GetRouteNameView));
+
+	// Словари названий больше не нужны - освобождаем их память
+	std::unordered_map<std::string_view, StopId>().swap(all_stops_map_);
+	std::unordered_map<std::string_view, RouteId>().swap(all_buses_map_);
+	frozen_ = true;
+}
+
+
+void TransportCatalogue::Freeze(PerfectHashData stops_index, PerfectHashData routes_index)
+{
+	Thaw();
+	// Если параметры не подходят к данным (база старого формата), индексы строятся заново
+	stops_index_ = PerfectHashIndex(std::move(stops_index), CollectNames(all_stops_data_, GetStopNameView));
+	routes_index_ = PerfectHashIndex(std::move(routes_index), CollectNames(all_buses_data_, GetRouteNameView));
+
+	std::unordered_map<std::string_view, StopId>().swap(all_stops_map_);
+	std::unordered_map<std::string_view, RouteId>().swap(all_buses_map_);
+	frozen_ = true;
+}
+
+
+bool TransportCatalogue::IsFrozen() const
+{
+	return frozen_;
+}
+
+
+const PerfectHashData& TransportCatalogue::GetStopsIndexData() const
+{
+	return stops_index_.GetData();
+}
+
+
+const PerfectHashData& TransportCatalogue::GetRoutesIndexData() const
+{
+	return routes_index_.GetData();
+}
+
+
+void TransportCatalogue::ReportMemory(memory_report::MemoryReport& report) const
+{
+	using namespace memory_report;
+	const std::string_view subsystem = "TransportCatalogue";
+
+	report.Add(subsystem, "names", names_->GetMemoryUsage());
+	report.Add(subsystem, "stops", DequeBytes(all_stops_data_));
+	report.Add(subsystem, "stops_map", HashTableBytes(all_stops_map_));
+	size_t route_stops_bytes = 0;
 	for (const auto& route : all_buses_data_)
 	{
-		route_ptrs.emplace_back(&route);
+		route_stops_bytes += VectorBytes(route.stops);
+	}
+	report.Add(subsystem, "routes", DequeBytes(all_buses_data_) + route_stops_bytes);
+	report.Add(subsystem, "routes_map", HashTableBytes(all_buses_map_));
+	report.Add(subsystem, "distances", distances_.GetMemoryUsage());
+	report.Add(subsystem, "coordinates", stops_coords_.GetMemoryUsage());
+	size_t stop_buses_bytes = DequeBytes(stop_buses_);
+	for (const auto& buses : stop_buses_)
+	{
+		stop_buses_bytes += VectorBytes(buses);
 	}
-	std::sort(route_ptrs.begin(), route_ptrs.end(), [](RoutePtr lhs, RoutePtr rhs)
-			  {
-				  return lhs->route_name <= rhs->route_name;
-			  });
-	return route_ptrs;
+	report.Add(subsystem, "stop_stats", DequeBytes(stop_stats_) + stop_buses_bytes);
+	report.Add(subsystem, "route_stats", DequeBytes(route_stats_));
+	report.Add(subsystem, "regions", VectorBytes(region_names_));
+	report.Add(subsystem, "orderings", VectorBytes(stops_by_id_) + VectorBytes(routes_by_name_));
+	report.Add(subsystem, "name_index", stops_index_.GetMemoryUsage() + routes_index_.GetMemoryUsage());
 }
 
 
-const std::unordered_map<std::pair<StopPtr, StopPtr>, size_t, PairPointersHasher>& TransportCatalogue::GetAllDistances() const
+void TransportCatalogue::Thaw()
 {
-	return distances_map_;
+	if (!frozen_)
+	{
+		return;
+	}
+	for (const auto& stop : all_stops_data_)
+	{
+		all_stops_map_.insert({ stop.name.View(), stop.id });
+	}
+	for (const auto& route : all_buses_data_)
+	{
+		all_buses_map_.insert({ route.route_name.View(), route.id });
+	}
+	stops_index_ = PerfectHashIndex();
+	routes_index_ = PerfectHashIndex();
+	frozen_ = false;
 }
 
 }
@@ -1,9 +1,16 @@
 #pragma once
 #include "geo.h"           // для работы с координатами остановок
 #include "domain.h"        // классы основных сущностей, описывают автобусы и остановки
+#include "distance_store.h"    // хранилище расстояний между остановками
+#include "perfect_hash.h"      // поиск по названиям в замороженном каталоге
+#include "memory_report.h"     // учет занимаемой памяти
+#include "ranges.h"            // для списка маршрутов в ответе об остановке
 
 #include <deque>
 #include <map>             // для словаря координат рендерера карт
+#include <memory>          // для арены названий, общей со снимками
+#include <memory_resource> // для размещения данных каталога в его арене
+#include <optional>        // для необязательного признака пограничной остановки
 #include <vector>
 #include <string>
 #include <string_view>
@@ -22,19 +29,27 @@ namespace transport_catalogue
 
 // ----------- Секция типов для ответов на запросы---------------
 
-// Структура ответа на запросы типа Информация об остановке и ее маршрутах
+// Отсортированные названия маршрутов в непрерывном хранилище владельца ответа
+using BusesRange = ranges::Range<const std::string_view*>;
+
+// Структура ответа на запросы типа Информация об остановке и ее маршрутах.
+// Хранится в каталоге, маршруты добавляются в AddRoute()
 struct StopStat
 {
 	// Параметризованный конструктор
-	explicit StopStat(std::string_view, std::set<std::string_view>&);
+	explicit StopStat(std::string_view);
 	std::string_view name;
-	std::set<std::string_view> buses;  // Должны быть отсортированными
+	BusesRange buses{ nullptr, nullptr };  // Должны быть отсортированными
 };
 
-// Тип: константный указатель на статистику об остановке и ее маршрутах
+// Указатели на остановки / маршруты в кэше каталога (действительны до изменения каталога)
+using StopsPtrRange = ranges::Range<const StopPtr*>;
+using RoutesPtrRange = ranges::Range<const RoutePtr*>;
+
+// Тип: константный указатель на статистику об остановке и ее маршрутах (владеет каталог)
 using StopStatPtr = const StopStat*;
 
-// Структура ответа на запросы типа Информация о маршруте
+// Структура ответа на запросы типа Информация о маршруте. Рассчитывается один раз в AddRoute()
 struct RouteStat
 {
 	// Параметризованный конструктор
@@ -43,57 +58,221 @@ struct RouteStat
 	size_t unique_stops = 0;
 	int64_t meters_route_length = 0;
 	double curvature = 0L;
-	std::string name;
+	std::string_view name;
 };
 
-// Тип: константный указатель на статистику о маршруте
+// Тип: константный указатель на статистику о маршруте (владеет каталог)
 using RouteStatPtr = const RouteStat*;
 
+// Что изменилось в каталоге с момента прошлой выборки изменений (для обновления
+// зависимых снимков и кэшей роутера)
+struct CatalogueChanges
+{
+	bool stops_added = false;    // Добавлены остановки (изменилось количество вершин графа)
+	bool coordinates = false;    // Изменены координаты остановок
+	bool distances = false;      // Изменены расстояния между остановками
+	bool routes = false;         // Добавлены, изменены или удалены маршруты
+	bool regions = false;        // Изменены пограничные остановки регионов
+
+	// Остановки и маршруты, у которых изменились данные или готовые ответы (для обновления
+	// снимка по частям). Номера могут повторяться, номер удаленного маршрута - не меньше
+	// количества маршрутов
+	std::vector<StopId> changed_stops;
+	std::vector<RouteId> changed_routes;
+
+	bool Any() const
+	{
+		return stops_added || coordinates || distances || routes || regions;
+	}
+};
+
+// ----------- Секция типов для пакетной загрузки ---------------
+
+// Описание остановки из входных данных. Строки должны оставаться живыми до конца AddBulk().
+// Описания временные, поэтому их векторы размещаются в арене этапа загрузки (см. AddToDB)
+struct StopDescription
+{
+	// Векторы описания выделяются из переданного источника памяти, поля заполняются по именам
+	explicit StopDescription(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		: road_distances(resource)
+	{}
+
+	std::string_view name;
+	geo::Coordinates coords;
+	std::pmr::vector<std::pair<std::string_view, size_t>> road_distances;   // Название соседней остановки, расстояние
+	bool is_boundary = false;
+};
+
+// Описание маршрута из входных данных (остановки - по названиям)
+struct RouteDescription
+{
+	explicit RouteDescription(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		: stops(resource)
+	{}
+
+	std::string_view name;
+	std::pmr::vector<std::string_view> stops;
+	bool is_circular = false;
+	std::string_view region;     // Пустое название - регион по умолчанию
+};
+
 // ----------- TransportCatalogue ---------------
 
 class TransportCatalogue
 {
 public:
+	static constexpr RegionId NO_REGION = UINT32_MAX;
+
 	TransportCatalogue();
 	~TransportCatalogue();
 
-	void AddStop(Stop&&);              // Добавляет остановку в словарь всех остановок
-	void AddRoute(Route&&);            // Добавляет маршрут в словарь всех маршрутов
-	void AddDistance(StopPtr, StopPtr, size_t);    // Добавляет расстояние между двумя остановками в словарь
-	size_t GetDistance(StopPtr, StopPtr);          // Возвращает расстояние (size_t метры) между двумя остановками с перестановкой пары
-	size_t GetDistanceDirectly(StopPtr, StopPtr);  // Возвращает расстояние (size_t метры) между двумя остановками без перестановки пары
+	// Добавляет остановку в словарь всех остановок, назначая ей номер. Название размещается в арене
+	void AddStop(std::string_view, geo::Coordinates, bool is_boundary = false);
+	// Добавляет маршрут (название, номера остановок, кольцевой ли, регион) в словарь всех маршрутов, назначая ему номер
+	void AddRoute(std::string_view, std::vector<StopId>, bool, std::string_view region = {});
+	// Возвращает номер региона по названию, добавляя регион при первом упоминании
+	RegionId AddRegion(std::string_view);
+	void AddDistance(StopId, StopId, size_t);    // Добавляет расстояние между двумя остановками в словарь
+
+	// Изменение заполненного каталога (режим запросов). Ответы пересчитываются только
+	// для затронутых маршрутов и остановок, изменения накапливаются до TakeChanges()
+
+	// Непограничную остановку обслуживают маршруты только одного региона. Изменение, которое
+	// нарушило бы это, отклоняется исключением std::invalid_argument до изменения каталога
+
+	// Добавляет остановку или меняет координаты (и признак пограничной) существующей.
+	// Без is_boundary признак существующей остановки не меняется, новая - не пограничная
+	void UpdateStop(std::string_view, geo::Coordinates, std::optional<bool> is_boundary = std::nullopt);
+	// Добавляет маршрут или заменяет остановки (кольцевость, регион) существующего
+	void UpdateRoute(std::string_view, std::vector<StopId>, bool, std::string_view region = {});
+	// Удаляет маршрут. Его номер переходит к последнему маршруту. false - маршрут не найден
+	bool RemoveRoute(std::string_view);
+	// Задает расстояние между остановками, перезаписывая заданное ранее
+	void SetDistance(StopId, StopId, size_t);
+	// Возвращает накопленные изменения и сбрасывает их
+	CatalogueChanges TakeChanges();
+
+	// Пакетная загрузка: резервирует память по количеству элементов, добавляет остановки,
+	// затем расстояния, затем маршруты. Расстояния и остановки маршрутов, ссылающиеся на
+	// неизвестные остановки, пропускаются. Статистика маршрутов считается параллельно.
+	// Бросает std::invalid_argument, если непограничную остановку обслуживают маршруты
+	// нескольких регионов (загрузка прерывается, каталог использовать нельзя)
+	void AddBulk(const std::pmr::vector<StopDescription>&, const std::pmr::vector<RouteDescription>&);
+	size_t GetDistance(StopId, StopId) const;          // Возвращает расстояние (size_t метры) между двумя остановками с перестановкой пары
+	size_t GetDistanceDirectly(StopId, StopId) const;  // Возвращает расстояние (size_t метры) между двумя остановками без перестановки пары
 
 	StopPtr GetStopByName(const std::string_view) const;    // Возвращает указатель на остановку по ее имени из словаря остановок
 	RoutePtr GetRouteByName(const std::string_view) const;  // Возвращает указатель на маршрут по его имени из словаря маршрутов
+	StopPtr GetStop(StopId) const;      // Возвращает указатель на остановку по ее номеру
+	RoutePtr GetRoute(RouteId) const;   // Возвращает указатель на маршрут по его номеру
 
+	// Возвращают указатели на готовые ответы, которые живут вместе с каталогом (nullptr - имя не найдено)
 	RouteStatPtr GetRouteInfo(const std::string_view) const;        // Возвращает указатель на результат запроса о маршруте
 	StopStatPtr GetBusesForStopInfo(const std::string_view) const;  // Возвращает указатель на результат запроса об автобусах для останоки
+	StopStatPtr GetStopStat(StopId) const;      // Готовые ответы по номеру остановки / маршрута
+	RouteStatPtr GetRouteStat(RouteId) const;
 
-	void GetAllRoutes(std::map<const std::string, RendererData>&) const;    // Возвращает словарь маршрутов с их остановками
 
 	size_t GetAllStopsCount() const;                     // ROUTER. Возвращает количество уникальных остановок в базе
-	const std::vector<StopPtr> GetAllStopsPtr() const;   // ROUTER. Возвращает вектор указателей на остановки
-	const std::deque<RoutePtr> GetAllRoutesPtr() const;  // ROUTER. Возвращает вектор указателей на маршруты
+	size_t GetAllRoutesCount() const;                    // Возвращает количество маршрутов в базе
+	size_t GetRegionsCount() const;                      // Возвращает количество регионов (включая регион по умолчанию)
+	std::string_view GetRegionName(RegionId) const;
+	std::shared_ptr<const StringArena> GetNamesArena() const;    // Арена всех названий каталога (для снимков)
+	StopsPtrRange GetAllStopsPtr() const;     // SERIALIZER. Возвращает указатели на остановки (по порядку номеров)
+	RoutesPtrRange GetAllRoutesPtr() const;   // SERIALIZER. Возвращает указатели на маршруты (по алфавиту)
 
-	// SERIALIZER. Возвращает read-only словарь расстояний между всеми остановками
-	const std::unordered_map<std::pair<StopPtr, StopPtr>, size_t, PairPointersHasher>& GetAllDistances() const;
+	// SERIALIZER. Возвращает read-only хранилище расстояний между всеми остановками
+	const DistanceStore& GetAllDistances() const;
+	// Координаты всех остановок в виде структуры массивов (индекс == номер остановки)
+	const geo::CoordinatesArray& GetStopsCoordinates() const;
+
+	// Замораживает каталог после загрузки: строит совершенные хэш-функции по названиям
+	// остановок и маршрутов и освобождает словари названий. Поиск по названию становится
+	// одним вычислением хэша и одним сравнением строк. Добавление данных размораживает каталог
+	void Freeze();
+	// DESERIALIZER. Замораживает каталог с готовыми (построенными в make_base) хэш-функциями.
+	// Если они не подходят к данным каталога, строит новые
+	void Freeze(PerfectHashData stops_index, PerfectHashData routes_index);
+	bool IsFrozen() const;
+	// SERIALIZER. Параметры хэш-функций замороженного каталога
+	const PerfectHashData& GetStopsIndexData() const;
+	const PerfectHashData& GetRoutesIndexData() const;
+
+	// Добавляет в отчет память структур каталога
+	void ReportMemory(memory_report::MemoryReport&) const;
 
 
 private:
-	std::deque<Stop> all_stops_data_;                                     // Дек с информацией обо всех остановках (реальные данные, не указатели)
-	std::unordered_map<std::string_view, StopPtr> all_stops_map_;         // Словарь остановок (словарь с хэш-функцией)
-	std::deque<Route> all_buses_data_;                                    // Дек с информацией обо всех маршрутах
-	std::unordered_map<std::string_view, RoutePtr> all_buses_map_;        // Словарь маршрутов (автобусов) (словарь с хэш-функцией)
-	std::unordered_map<std::pair<StopPtr, StopPtr>, size_t, PairPointersHasher> distances_map_;    // Словарь расстояний между остановками
+	// Память хранилищ каталога. Записи об остановках и маршрутах, их остановки и ответы живут
+	// до конца жизни каталога, поэтому выделяются из монотонной арены крупными блоками без
+	// служебных данных кучи и освобождаются разом вместе с каталогом. Пул поверх арены
+	// повторно использует память, освобожденную при изменении каталога (замена остановок
+	// маршрута, рост списков маршрутов остановки). Словари названий освобождаются при
+	// заморозке и остаются в обычной куче. Ресурсы объявлены первыми: они должны жить
+	// дольше всех выделенных из них контейнеров. Каталог меняет один поток (см. кэши ниже),
+	// поэтому пул без синхронизации
+	std::pmr::monotonic_buffer_resource arena_;
+	std::pmr::unsynchronized_pool_resource pool_{ &arena_ };
+	// Арена названий объявлена до хранилищ: она должна жить дольше всех ссылающихся на нее структур.
+	// Снимки FrozenCatalogue ссылаются на названия каталога и держат арену вместе с ним. Арена
+	// только дописывается и только потоком, меняющим каталог, поэтому названия снимка не меняются
+	std::shared_ptr<StringArena> names_ = std::make_shared<StringArena>();
+	// Дек не перемещает элементы при добавлении (указатели на них остаются валидными)
+	// и индексируется номером за O(1). Номер остановки/маршрута == индекс в деке
+	std::pmr::deque<Stop> all_stops_data_{ &pool_ };                     // Дек с информацией обо всех остановках (реальные данные, не указатели)
+	std::unordered_map<std::string_view, StopId> all_stops_map_;          // Словарь номеров остановок по названию
+	std::pmr::deque<Route> all_buses_data_{ &pool_ };                     // Дек с информацией обо всех маршрутах
+	std::unordered_map<std::string_view, RouteId> all_buses_map_;         // Словарь номеров маршрутов (автобусов) по названию
+	DistanceStore distances_;                                             // Расстояния между остановками
+	geo::CoordinatesArray stops_coords_;                                  // Координаты остановок по номеру (для пакетных расчетов)
+	std::pmr::deque<StopStat> stop_stats_{ &pool_ };      // Ответы на запросы об остановках по номеру (включая отсортированные маршруты через нее)
+	std::pmr::deque<std::pmr::vector<std::string_view>> stop_buses_{ &pool_ };    // Отсортированные маршруты через остановку (для stop_stats_)
+	std::pmr::deque<RouteStat> route_stats_{ &pool_ };    // Ответы на запросы о маршрутах по номеру
+	std::vector<InternedString> region_names_;            // Названия регионов по номеру (регионов единицы - поиск перебором)
+
+	// Кэши порядков обхода. Остановки не удаляются и не перемещаются - указатели на них
+	// дописываются при добавлении. Порядок маршрутов по алфавиту сбрасывается при добавлении
+	// и удалении маршрута и пересобирается при следующем обращении (каталог читает и меняет
+	// один поток, читатели в режиме запросов работают со снимками FrozenCatalogue)
+	std::vector<StopPtr> stops_by_id_;
+	mutable std::vector<RoutePtr> routes_by_name_;
+	mutable bool routes_by_name_valid_ = true;
+
+	// Замороженный каталог: вместо словарей названий - индексы на совершенных хэш-функциях
+	bool frozen_ = false;
+
+	CatalogueChanges changes_;    // Изменения с прошлого вызова TakeChanges()
+	PerfectHashIndex stops_index_;
+	PerfectHashIndex routes_index_;
+
+	// Восстанавливает словари названий и сбрасывает хэш-функции перед изменением каталога
+	void Thaw();
+
+	// Этапы добавления маршрута. Размещает маршрут в хранилище и назначает ему номер
+	Route& EmplaceRoute(std::string_view, std::pmr::vector<StopId>, bool, RegionId);
+	// Считает уникальные остановки, длины и кривизну. Читает только общие данные каталога,
+	// поэтому может выполняться для разных маршрутов параллельно
+	void ComputeRouteStat(Route&) const;
+	// Регистрирует маршрут в ответах об остановках и сохраняет ответ о маршруте.
+	// Вызывается в порядке номеров маршрутов
+	void RegisterRouteStat(const Route&);
+	// Убирает маршрут из ответов об остановках (перед изменением или удалением маршрута)
+	void UnregisterRouteStops(const Route&);
+	// Сохраняет ответ о маршруте на место его номера
+	void StoreRouteStat(const Route&);
+	// Пересчитывает ответы о маршрутах, проходящих через остановку
+	void RecomputeRoutesThrough(StopId);
+	// Возвращает номер региона по названию или NO_REGION, если такого региона нет
+	RegionId FindRegion(std::string_view) const;
+	// Регион маршрутов через остановку, кроме маршрута except. NO_REGION - других маршрутов нет
+	RegionId GetStopRegion(StopId, std::string_view except = {}) const;
+	// Бросает std::invalid_argument: непограничную остановку обслуживают маршруты двух регионов
+	[[noreturn]] void ThrowRegionConflict(StopId, std::string_view region, std::string_view other_region) const;
 
 	// Возвращает string_view с именем остановки по указателю на экземпляр структуры Stop
 	std::string_view GetStopName(StopPtr stop_ptr);
-	// Возвращает string_view с именем остановки для экземпляра структуры Stop
-	std::string_view GetStopName(const Stop stop);
 
 	// Возвращает string_view с номером автобуса по указателю на экземпляр структуры Route
 	std::string_view GetBusName(RoutePtr route_ptr);
-	// Возвращает string_view с номером автобуса для экземпляра структуры Route
-	std::string_view GetBusName(const Route route);
 };
 }
@@ -39,6 +39,7 @@ PROTOBUF_CONSTEXPR Stop::Stop(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.coords_)*/nullptr
+  , /*decltype(_impl_.is_boundary_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StopDefaultTypeInternal {
   PROTOBUF_CONSTEXPR StopDefaultTypeInternal()
@@ -51,9 +52,9 @@ struct StopDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopDefaultTypeInternal _Stop_default_instance_;
 PROTOBUF_CONSTEXPR Distance::Distance(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.from_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.distance_)*/0u
+    /*decltype(_impl_.distance_)*/0u
+  , /*decltype(_impl_.stop_from_)*/0u
+  , /*decltype(_impl_.stop_to_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct DistanceDefaultTypeInternal {
   PROTOBUF_CONSTEXPR DistanceDefaultTypeInternal()
@@ -66,9 +67,11 @@ struct DistanceDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DistanceDefaultTypeInternal _Distance_default_instance_;
 PROTOBUF_CONSTEXPR Route::Route(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.stops_)*/{}
+    /*decltype(_impl_.stop_ids_)*/{}
+  , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
   , /*decltype(_impl_.route_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.is_circular_)*/false
+  , /*decltype(_impl_.region_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RouteDefaultTypeInternal {
   PROTOBUF_CONSTEXPR RouteDefaultTypeInternal()
@@ -79,13 +82,33 @@ struct RouteDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouteDefaultTypeInternal _Route_default_instance_;
+PROTOBUF_CONSTEXPR NameIndex::NameIndex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.displacements_)*/{}
+  , /*decltype(_impl_._displacements_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.seed_)*/uint64_t{0u}
+  , /*decltype(_impl_.keys_count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NameIndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NameIndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NameIndexDefaultTypeInternal() {}
+  union {
+    NameIndex _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NameIndexDefaultTypeInternal _NameIndex_default_instance_;
 PROTOBUF_CONSTEXPR TransportCatalogue::TransportCatalogue(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.stops_)*/{}
   , /*decltype(_impl_.routes_)*/{}
   , /*decltype(_impl_.distances_)*/{}
+  , /*decltype(_impl_.region_names_)*/{}
   , /*decltype(_impl_.renderer_settings_)*/nullptr
   , /*decltype(_impl_.router_settings_)*/nullptr
+  , /*decltype(_impl_.router_partition_)*/nullptr
+  , /*decltype(_impl_.stops_index_)*/nullptr
+  , /*decltype(_impl_.routes_index_)*/nullptr
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TransportCatalogueDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TransportCatalogueDefaultTypeInternal()
@@ -97,7 +120,7 @@ struct TransportCatalogueDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransportCatalogueDefaultTypeInternal _TransportCatalogue_default_instance_;
 }  // namespace proto_serialization
-static ::_pb::Metadata file_level_metadata_transport_5fcatalogue_2eproto[5];
+static ::_pb::Metadata file_level_metadata_transport_5fcatalogue_2eproto[6];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_transport_5fcatalogue_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalogue_2eproto = nullptr;
 
@@ -118,14 +141,15 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Stop, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Stop, _impl_.coords_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::Stop, _impl_.is_boundary_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Distance, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::proto_serialization::Distance, _impl_.from_),
-  PROTOBUF_FIELD_OFFSET(::proto_serialization::Distance, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::Distance, _impl_.stop_from_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::Distance, _impl_.stop_to_),
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Distance, _impl_.distance_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Route, _internal_metadata_),
@@ -134,8 +158,18 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Route, _impl_.route_name_),
-  PROTOBUF_FIELD_OFFSET(::proto_serialization::Route, _impl_.stops_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::Route, _impl_.stop_ids_),
   PROTOBUF_FIELD_OFFSET(::proto_serialization::Route, _impl_.is_circular_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::Route, _impl_.region_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::NameIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::NameIndex, _impl_.seed_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::NameIndex, _impl_.keys_count_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::NameIndex, _impl_.displacements_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -147,13 +181,18 @@ const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SEC
   PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.distances_),
   PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.renderer_settings_),
   PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.router_settings_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.router_partition_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.stops_index_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.routes_index_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::TransportCatalogue, _impl_.region_names_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::proto_serialization::Coordinates)},
   { 8, -1, -1, sizeof(::proto_serialization::Stop)},
-  { 16, -1, -1, sizeof(::proto_serialization::Distance)},
-  { 25, -1, -1, sizeof(::proto_serialization::Route)},
-  { 34, -1, -1, sizeof(::proto_serialization::TransportCatalogue)},
+  { 17, -1, -1, sizeof(::proto_serialization::Distance)},
+  { 26, -1, -1, sizeof(::proto_serialization::Route)},
+  { 36, -1, -1, sizeof(::proto_serialization::NameIndex)},
+  { 45, -1, -1, sizeof(::proto_serialization::TransportCatalogue)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -161,6 +200,7 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::proto_serialization::_Stop_default_instance_._instance,
   &::proto_serialization::_Distance_default_instance_._instance,
   &::proto_serialization::_Route_default_instance_._instance,
+  &::proto_serialization::_NameIndex_default_instance_._instance,
   &::proto_serialization::_TransportCatalogue_default_instance_._instance,
 };
 
@@ -168,20 +208,27 @@ const char descriptor_table_protodef_transport_5fcatalogue_2eproto[] PROTOBUF_SE
   "\n\031transport_catalogue.proto\022\023proto_seria"
   "lization\032\022map_renderer.proto\032\026transport_"
   "router.proto\"\'\n\013Coordinates\022\013\n\003lat\030\001 \001(\001"
-  "\022\013\n\003lng\030\002 \001(\001\"F\n\004Stop\022\014\n\004name\030\001 \001(\014\0220\n\006c"
+  "\022\013\n\003lng\030\002 \001(\001\"[\n\004Stop\022\014\n\004name\030\001 \001(\014\0220\n\006c"
   "oords\030\002 \001(\0132 .proto_serialization.Coordi"
-  "nates\"6\n\010Distance\022\014\n\004from\030\001 \001(\014\022\n\n\002to\030\002 "
-  "\001(\014\022\020\n\010distance\030\003 \001(\r\"Z\n\005Route\022\022\n\nroute_"
-  "name\030\001 \001(\014\022(\n\005stops\030\002 \003(\0132\031.proto_serial"
-  "ization.Stop\022\023\n\013is_circular\030\003 \001(\010\"\234\002\n\022Tr"
-  "ansportCatalogue\022(\n\005stops\030\001 \003(\0132\031.proto_"
-  "serialization.Stop\022*\n\006routes\030\002 \003(\0132\032.pro"
-  "to_serialization.Route\0220\n\tdistances\030\003 \003("
-  "\0132\035.proto_serialization.Distance\022@\n\021rend"
-  "erer_settings\030\004 \001(\0132%.proto_serializatio"
-  "n.RendererSettings\022<\n\017router_settings\030\005 "
-  "\001(\0132#.proto_serialization.RouterSettings"
-  "b\006proto3"
+  "nates\022\023\n\013is_boundary\030\003 \001(\010\"L\n\010Distance\022\021"
+  "\n\tstop_from\030\004 \001(\r\022\017\n\007stop_to\030\005 \001(\r\022\020\n\010di"
+  "stance\030\003 \001(\rJ\004\010\001\020\002J\004\010\002\020\003\"X\n\005Route\022\022\n\nrou"
+  "te_name\030\001 \001(\014\022\020\n\010stop_ids\030\004 \003(\r\022\023\n\013is_ci"
+  "rcular\030\003 \001(\010\022\016\n\006region\030\005 \001(\rJ\004\010\002\020\003\"D\n\tNa"
+  "meIndex\022\014\n\004seed\030\001 \001(\004\022\022\n\nkeys_count\030\002 \001("
+  "\r\022\025\n\rdisplacements\030\003 \003(\r\"\335\003\n\022TransportCa"
+  "talogue\022(\n\005stops\030\001 \003(\0132\031.proto_serializa"
+  "tion.Stop\022*\n\006routes\030\002 \003(\0132\032.proto_serial"
+  "ization.Route\0220\n\tdistances\030\003 \003(\0132\035.proto"
+  "_serialization.Distance\022@\n\021renderer_sett"
+  "ings\030\004 \001(\0132%.proto_serialization.Rendere"
+  "rSettings\022<\n\017router_settings\030\005 \001(\0132#.pro"
+  "to_serialization.RouterSettings\022>\n\020route"
+  "r_partition\030\006 \001(\0132$.proto_serialization."
+  "RouterPartition\0223\n\013stops_index\030\007 \001(\0132\036.p"
+  "roto_serialization.NameIndex\0224\n\014routes_i"
+  "ndex\030\010 \001(\0132\036.proto_serialization.NameInd"
+  "ex\022\024\n\014region_names\030\t \003(\014b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_transport_5fcatalogue_2eproto_deps[2] = {
   &::descriptor_table_map_5frenderer_2eproto,
@@ -189,9 +236,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_transport_5fcatalog
 };
 static ::_pbi::once_flag descriptor_table_transport_5fcatalogue_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto = {
-    false, false, 648, descriptor_table_protodef_transport_5fcatalogue_2eproto,
+    false, false, 952, descriptor_table_protodef_transport_5fcatalogue_2eproto,
     "transport_catalogue.proto",
-    &descriptor_table_transport_5fcatalogue_2eproto_once, descriptor_table_transport_5fcatalogue_2eproto_deps, 2, 5,
+    &descriptor_table_transport_5fcatalogue_2eproto_once, descriptor_table_transport_5fcatalogue_2eproto_deps, 2, 6,
     schemas, file_default_instances, TableStruct_transport_5fcatalogue_2eproto::offsets,
     file_level_metadata_transport_5fcatalogue_2eproto, file_level_enum_descriptors_transport_5fcatalogue_2eproto,
     file_level_service_descriptors_transport_5fcatalogue_2eproto,
@@ -462,6 +509,7 @@ Stop::Stop(const Stop& from)
   new (&_impl_) Impl_{
       decltype(_impl_.name_){}
     , decltype(_impl_.coords_){nullptr}
+    , decltype(_impl_.is_boundary_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -476,6 +524,7 @@ Stop::Stop(const Stop& from)
   if (from._internal_has_coords()) {
     _this->_impl_.coords_ = new ::proto_serialization::Coordinates(*from._impl_.coords_);
   }
+  _this->_impl_.is_boundary_ = from._impl_.is_boundary_;
   // @@protoc_insertion_point(copy_constructor:proto_serialization.Stop)
 }
 
@@ -486,6 +535,7 @@ inline void Stop::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.name_){}
     , decltype(_impl_.coords_){nullptr}
+    , decltype(_impl_.is_boundary_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.name_.InitDefault();
@@ -524,6 +574,7 @@ void Stop::Clear() {
     delete _impl_.coords_;
   }
   _impl_.coords_ = nullptr;
+  _impl_.is_boundary_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -550,6 +601,14 @@ const char* Stop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // bool is_boundary = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.is_boundary_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -592,6 +651,12 @@ uint8_t* Stop::_InternalSerialize(
         _Internal::coords(this).GetCachedSize(), target, stream);
   }
 
+  // bool is_boundary = 3;
+  if (this->_internal_is_boundary() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_boundary(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -622,6 +687,11 @@ size_t Stop::ByteSizeLong() const {
         *_impl_.coords_);
   }
 
+  // bool is_boundary = 3;
+  if (this->_internal_is_boundary() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -647,6 +717,9 @@ void Stop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_
     _this->_internal_mutable_coords()->::proto_serialization::Coordinates::MergeFrom(
         from._internal_coords());
   }
+  if (from._internal_is_boundary() != 0) {
+    _this->_internal_set_is_boundary(from._internal_is_boundary());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -670,7 +743,12 @@ void Stop::InternalSwap(Stop* other) {
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
-  swap(_impl_.coords_, other->_impl_.coords_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stop, _impl_.is_boundary_)
+      + sizeof(Stop::_impl_.is_boundary_)
+      - PROTOBUF_FIELD_OFFSET(Stop, _impl_.coords_)>(
+          reinterpret_cast<char*>(&_impl_.coords_),
+          reinterpret_cast<char*>(&other->_impl_.coords_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Stop::GetMetadata() const {
@@ -695,29 +773,15 @@ Distance::Distance(const Distance& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   Distance* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.from_){}
-    , decltype(_impl_.to_){}
-    , decltype(_impl_.distance_){}
+      decltype(_impl_.distance_){}
+    , decltype(_impl_.stop_from_){}
+    , decltype(_impl_.stop_to_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.from_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.from_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_from().empty()) {
-    _this->_impl_.from_.Set(from._internal_from(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.to_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.to_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_to().empty()) {
-    _this->_impl_.to_.Set(from._internal_to(), 
-      _this->GetArenaForAllocation());
-  }
-  _this->_impl_.distance_ = from._impl_.distance_;
+  ::memcpy(&_impl_.distance_, &from._impl_.distance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stop_to_) -
+    reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.stop_to_));
   // @@protoc_insertion_point(copy_constructor:proto_serialization.Distance)
 }
 
@@ -726,19 +790,11 @@ inline void Distance::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.from_){}
-    , decltype(_impl_.to_){}
-    , decltype(_impl_.distance_){0u}
+      decltype(_impl_.distance_){0u}
+    , decltype(_impl_.stop_from_){0u}
+    , decltype(_impl_.stop_to_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.from_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.from_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.to_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.to_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Distance::~Distance() {
@@ -752,8 +808,6 @@ Distance::~Distance() {
 
 inline void Distance::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.from_.Destroy();
-  _impl_.to_.Destroy();
 }
 
 void Distance::SetCachedSize(int size) const {
@@ -766,9 +820,9 @@ void Distance::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.from_.ClearToEmpty();
-  _impl_.to_.ClearToEmpty();
-  _impl_.distance_ = 0u;
+  ::memset(&_impl_.distance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.stop_to_) -
+      reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.stop_to_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -778,28 +832,26 @@ const char* Distance::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bytes from = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_from();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+      // uint32 distance = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.distance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // bytes to = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_to();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+      // uint32 stop_from = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.stop_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // uint32 distance = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.distance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+      // uint32 stop_to = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.stop_to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -833,22 +885,22 @@ uint8_t* Distance::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bytes from = 1;
-  if (!this->_internal_from().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        1, this->_internal_from(), target);
+  // uint32 distance = 3;
+  if (this->_internal_distance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_distance(), target);
   }
 
-  // bytes to = 2;
-  if (!this->_internal_to().empty()) {
-    target = stream->WriteBytesMaybeAliased(
-        2, this->_internal_to(), target);
+  // uint32 stop_from = 4;
+  if (this->_internal_stop_from() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_stop_from(), target);
   }
 
-  // uint32 distance = 3;
-  if (this->_internal_distance() != 0) {
+  // uint32 stop_to = 5;
+  if (this->_internal_stop_to() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_distance(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_stop_to(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -867,23 +919,19 @@ size_t Distance::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes from = 1;
-  if (!this->_internal_from().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_from());
+  // uint32 distance = 3;
+  if (this->_internal_distance() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_distance());
   }
 
-  // bytes to = 2;
-  if (!this->_internal_to().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_to());
+  // uint32 stop_from = 4;
+  if (this->_internal_stop_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_from());
   }
 
-  // uint32 distance = 3;
-  if (this->_internal_distance() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_distance());
+  // uint32 stop_to = 5;
+  if (this->_internal_stop_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_to());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
@@ -904,15 +952,15 @@ void Distance::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTO
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_from().empty()) {
-    _this->_internal_set_from(from._internal_from());
-  }
-  if (!from._internal_to().empty()) {
-    _this->_internal_set_to(from._internal_to());
-  }
   if (from._internal_distance() != 0) {
     _this->_internal_set_distance(from._internal_distance());
   }
+  if (from._internal_stop_from() != 0) {
+    _this->_internal_set_stop_from(from._internal_stop_from());
+  }
+  if (from._internal_stop_to() != 0) {
+    _this->_internal_set_stop_to(from._internal_stop_to());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -929,18 +977,13 @@ bool Distance::IsInitialized() const {
 
 void Distance::InternalSwap(Distance* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.from_, lhs_arena,
-      &other->_impl_.from_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.to_, lhs_arena,
-      &other->_impl_.to_, rhs_arena
-  );
-  swap(_impl_.distance_, other->_impl_.distance_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Distance, _impl_.stop_to_)
+      + sizeof(Distance::_impl_.stop_to_)
+      - PROTOBUF_FIELD_OFFSET(Distance, _impl_.distance_)>(
+          reinterpret_cast<char*>(&_impl_.distance_),
+          reinterpret_cast<char*>(&other->_impl_.distance_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Distance::GetMetadata() const {
@@ -965,9 +1008,11 @@ Route::Route(const Route& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   Route* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.stops_){from._impl_.stops_}
+      decltype(_impl_.stop_ids_){from._impl_.stop_ids_}
+    , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
     , decltype(_impl_.route_name_){}
     , decltype(_impl_.is_circular_){}
+    , decltype(_impl_.region_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -979,7 +1024,9 @@ Route::Route(const Route& from)
     _this->_impl_.route_name_.Set(from._internal_route_name(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.is_circular_ = from._impl_.is_circular_;
+  ::memcpy(&_impl_.is_circular_, &from._impl_.is_circular_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.region_) -
+    reinterpret_cast<char*>(&_impl_.is_circular_)) + sizeof(_impl_.region_));
   // @@protoc_insertion_point(copy_constructor:proto_serialization.Route)
 }
 
@@ -988,9 +1035,11 @@ inline void Route::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.stops_){arena}
+      decltype(_impl_.stop_ids_){arena}
+    , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
     , decltype(_impl_.route_name_){}
     , decltype(_impl_.is_circular_){false}
+    , decltype(_impl_.region_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.route_name_.InitDefault();
@@ -1010,7 +1059,7 @@ Route::~Route() {
 
 inline void Route::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.stops_.~RepeatedPtrField();
+  _impl_.stop_ids_.~RepeatedField();
   _impl_.route_name_.Destroy();
 }
 
@@ -1024,9 +1073,11 @@ void Route::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.stops_.Clear();
+  _impl_.stop_ids_.Clear();
   _impl_.route_name_.ClearToEmpty();
-  _impl_.is_circular_ = false;
+  ::memset(&_impl_.is_circular_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.region_) -
+      reinterpret_cast<char*>(&_impl_.is_circular_)) + sizeof(_impl_.region_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1045,19 +1096,6 @@ const char* Route::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
-      // repeated .proto_serialization.Stop stops = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_stops(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
       // bool is_circular = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
@@ -1066,6 +1104,25 @@ const char* Route::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // repeated uint32 stop_ids = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_stop_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_stop_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 region = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.region_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1101,20 +1158,27 @@ uint8_t* Route::_InternalSerialize(
         1, this->_internal_route_name(), target);
   }
 
-  // repeated .proto_serialization.Stop stops = 2;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_stops_size()); i < n; i++) {
-    const auto& repfield = this->_internal_stops(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
   // bool is_circular = 3;
   if (this->_internal_is_circular() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_circular(), target);
   }
 
+  // repeated uint32 stop_ids = 4;
+  {
+    int byte_size = _impl_._stop_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_stop_ids(), byte_size, target);
+    }
+  }
+
+  // uint32 region = 5;
+  if (this->_internal_region() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_region(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1131,11 +1195,18 @@ size_t Route::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .proto_serialization.Stop stops = 2;
-  total_size += 1UL * this->_internal_stops_size();
-  for (const auto& msg : this->_impl_.stops_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // repeated uint32 stop_ids = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.stop_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._stop_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
   // bytes route_name = 1;
@@ -1150,6 +1221,11 @@ size_t Route::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
+  // uint32 region = 5;
+  if (this->_internal_region() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_region());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1168,13 +1244,16 @@ void Route::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_impl_.stop_ids_.MergeFrom(from._impl_.stop_ids_);
   if (!from._internal_route_name().empty()) {
     _this->_internal_set_route_name(from._internal_route_name());
   }
   if (from._internal_is_circular() != 0) {
     _this->_internal_set_is_circular(from._internal_is_circular());
   }
+  if (from._internal_region() != 0) {
+    _this->_internal_set_region(from._internal_region());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1194,12 +1273,17 @@ void Route::InternalSwap(Route* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.stops_.InternalSwap(&other->_impl_.stops_);
+  _impl_.stop_ids_.InternalSwap(&other->_impl_.stop_ids_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.route_name_, lhs_arena,
       &other->_impl_.route_name_, rhs_arena
   );
-  swap(_impl_.is_circular_, other->_impl_.is_circular_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Route, _impl_.region_)
+      + sizeof(Route::_impl_.region_)
+      - PROTOBUF_FIELD_OFFSET(Route, _impl_.is_circular_)>(
+          reinterpret_cast<char*>(&_impl_.is_circular_),
+          reinterpret_cast<char*>(&other->_impl_.is_circular_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Route::GetMetadata() const {
@@ -1210,10 +1294,266 @@ void Route::InternalSwap(Route* other) {
 
 // ===================================================================
 
+class NameIndex::_Internal {
+ public:
+};
+
+NameIndex::NameIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_serialization.NameIndex)
+}
+NameIndex::NameIndex(const NameIndex& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NameIndex* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.displacements_){from._impl_.displacements_}
+    , /*decltype(_impl_._displacements_cached_byte_size_)*/{0}
+    , decltype(_impl_.seed_){}
+    , decltype(_impl_.keys_count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.seed_, &from._impl_.seed_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.keys_count_) -
+    reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.keys_count_));
+  // @@protoc_insertion_point(copy_constructor:proto_serialization.NameIndex)
+}
+
+inline void NameIndex::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.displacements_){arena}
+    , /*decltype(_impl_._displacements_cached_byte_size_)*/{0}
+    , decltype(_impl_.seed_){uint64_t{0u}}
+    , decltype(_impl_.keys_count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+NameIndex::~NameIndex() {
+  // @@protoc_insertion_point(destructor:proto_serialization.NameIndex)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NameIndex::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.displacements_.~RepeatedField();
+}
+
+void NameIndex::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NameIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_serialization.NameIndex)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.displacements_.Clear();
+  ::memset(&_impl_.seed_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.keys_count_) -
+      reinterpret_cast<char*>(&_impl_.seed_)) + sizeof(_impl_.keys_count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NameIndex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 seed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.seed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 keys_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.keys_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 displacements = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_displacements(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_displacements(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NameIndex::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_serialization.NameIndex)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 seed = 1;
+  if (this->_internal_seed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_seed(), target);
+  }
+
+  // uint32 keys_count = 2;
+  if (this->_internal_keys_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_keys_count(), target);
+  }
+
+  // repeated uint32 displacements = 3;
+  {
+    int byte_size = _impl_._displacements_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_displacements(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_serialization.NameIndex)
+  return target;
+}
+
+size_t NameIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_serialization.NameIndex)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 displacements = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.displacements_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._displacements_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 seed = 1;
+  if (this->_internal_seed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seed());
+  }
+
+  // uint32 keys_count = 2;
+  if (this->_internal_keys_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_keys_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NameIndex::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NameIndex::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NameIndex::GetClassData() const { return &_class_data_; }
+
+
+void NameIndex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NameIndex*>(&to_msg);
+  auto& from = static_cast<const NameIndex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_serialization.NameIndex)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.displacements_.MergeFrom(from._impl_.displacements_);
+  if (from._internal_seed() != 0) {
+    _this->_internal_set_seed(from._internal_seed());
+  }
+  if (from._internal_keys_count() != 0) {
+    _this->_internal_set_keys_count(from._internal_keys_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NameIndex::CopyFrom(const NameIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_serialization.NameIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NameIndex::IsInitialized() const {
+  return true;
+}
+
+void NameIndex::InternalSwap(NameIndex* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.displacements_.InternalSwap(&other->_impl_.displacements_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NameIndex, _impl_.keys_count_)
+      + sizeof(NameIndex::_impl_.keys_count_)
+      - PROTOBUF_FIELD_OFFSET(NameIndex, _impl_.seed_)>(
+          reinterpret_cast<char*>(&_impl_.seed_),
+          reinterpret_cast<char*>(&other->_impl_.seed_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NameIndex::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[4]);
+}
+
+// ===================================================================
+
 class TransportCatalogue::_Internal {
  public:
   static const ::proto_serialization::RendererSettings& renderer_settings(const TransportCatalogue* msg);
   static const ::proto_serialization::RouterSettings& router_settings(const TransportCatalogue* msg);
+  static const ::proto_serialization::RouterPartition& router_partition(const TransportCatalogue* msg);
+  static const ::proto_serialization::NameIndex& stops_index(const TransportCatalogue* msg);
+  static const ::proto_serialization::NameIndex& routes_index(const TransportCatalogue* msg);
 };
 
 const ::proto_serialization::RendererSettings&
@@ -1224,6 +1564,18 @@ const ::proto_serialization::RouterSettings&
 TransportCatalogue::_Internal::router_settings(const TransportCatalogue* msg) {
   return *msg->_impl_.router_settings_;
 }
+const ::proto_serialization::RouterPartition&
+TransportCatalogue::_Internal::router_partition(const TransportCatalogue* msg) {
+  return *msg->_impl_.router_partition_;
+}
+const ::proto_serialization::NameIndex&
+TransportCatalogue::_Internal::stops_index(const TransportCatalogue* msg) {
+  return *msg->_impl_.stops_index_;
+}
+const ::proto_serialization::NameIndex&
+TransportCatalogue::_Internal::routes_index(const TransportCatalogue* msg) {
+  return *msg->_impl_.routes_index_;
+}
 void TransportCatalogue::clear_renderer_settings() {
   if (GetArenaForAllocation() == nullptr && _impl_.renderer_settings_ != nullptr) {
     delete _impl_.renderer_settings_;
@@ -1236,6 +1588,12 @@ void TransportCatalogue::clear_router_settings() {
   }
   _impl_.router_settings_ = nullptr;
 }
+void TransportCatalogue::clear_router_partition() {
+  if (GetArenaForAllocation() == nullptr && _impl_.router_partition_ != nullptr) {
+    delete _impl_.router_partition_;
+  }
+  _impl_.router_partition_ = nullptr;
+}
 TransportCatalogue::TransportCatalogue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -1249,8 +1607,12 @@ TransportCatalogue::TransportCatalogue(const TransportCatalogue& from)
       decltype(_impl_.stops_){from._impl_.stops_}
     , decltype(_impl_.routes_){from._impl_.routes_}
     , decltype(_impl_.distances_){from._impl_.distances_}
+    , decltype(_impl_.region_names_){from._impl_.region_names_}
     , decltype(_impl_.renderer_settings_){nullptr}
     , decltype(_impl_.router_settings_){nullptr}
+    , decltype(_impl_.router_partition_){nullptr}
+    , decltype(_impl_.stops_index_){nullptr}
+    , decltype(_impl_.routes_index_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1260,6 +1622,15 @@ TransportCatalogue::TransportCatalogue(const TransportCatalogue& from)
   if (from._internal_has_router_settings()) {
     _this->_impl_.router_settings_ = new ::proto_serialization::RouterSettings(*from._impl_.router_settings_);
   }
+  if (from._internal_has_router_partition()) {
+    _this->_impl_.router_partition_ = new ::proto_serialization::RouterPartition(*from._impl_.router_partition_);
+  }
+  if (from._internal_has_stops_index()) {
+    _this->_impl_.stops_index_ = new ::proto_serialization::NameIndex(*from._impl_.stops_index_);
+  }
+  if (from._internal_has_routes_index()) {
+    _this->_impl_.routes_index_ = new ::proto_serialization::NameIndex(*from._impl_.routes_index_);
+  }
   // @@protoc_insertion_point(copy_constructor:proto_serialization.TransportCatalogue)
 }
 
@@ -1271,8 +1642,12 @@ inline void TransportCatalogue::SharedCtor(
       decltype(_impl_.stops_){arena}
     , decltype(_impl_.routes_){arena}
     , decltype(_impl_.distances_){arena}
+    , decltype(_impl_.region_names_){arena}
     , decltype(_impl_.renderer_settings_){nullptr}
     , decltype(_impl_.router_settings_){nullptr}
+    , decltype(_impl_.router_partition_){nullptr}
+    , decltype(_impl_.stops_index_){nullptr}
+    , decltype(_impl_.routes_index_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -1291,8 +1666,12 @@ inline void TransportCatalogue::SharedDtor() {
   _impl_.stops_.~RepeatedPtrField();
   _impl_.routes_.~RepeatedPtrField();
   _impl_.distances_.~RepeatedPtrField();
+  _impl_.region_names_.~RepeatedPtrField();
   if (this != internal_default_instance()) delete _impl_.renderer_settings_;
   if (this != internal_default_instance()) delete _impl_.router_settings_;
+  if (this != internal_default_instance()) delete _impl_.router_partition_;
+  if (this != internal_default_instance()) delete _impl_.stops_index_;
+  if (this != internal_default_instance()) delete _impl_.routes_index_;
 }
 
 void TransportCatalogue::SetCachedSize(int size) const {
@@ -1308,6 +1687,7 @@ void TransportCatalogue::Clear() {
   _impl_.stops_.Clear();
   _impl_.routes_.Clear();
   _impl_.distances_.Clear();
+  _impl_.region_names_.Clear();
   if (GetArenaForAllocation() == nullptr && _impl_.renderer_settings_ != nullptr) {
     delete _impl_.renderer_settings_;
   }
@@ -1316,6 +1696,18 @@ void TransportCatalogue::Clear() {
     delete _impl_.router_settings_;
   }
   _impl_.router_settings_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.router_partition_ != nullptr) {
+    delete _impl_.router_partition_;
+  }
+  _impl_.router_partition_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stops_index_ != nullptr) {
+    delete _impl_.stops_index_;
+  }
+  _impl_.stops_index_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.routes_index_ != nullptr) {
+    delete _impl_.routes_index_;
+  }
+  _impl_.routes_index_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1380,6 +1772,44 @@ const char* TransportCatalogue::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
+      // .proto_serialization.RouterPartition router_partition = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_router_partition(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_serialization.NameIndex stops_index = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stops_index(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_serialization.NameIndex routes_index = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_routes_index(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes region_names = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_region_names();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1447,6 +1877,33 @@ uint8_t* TransportCatalogue::_InternalSerialize(
         _Internal::router_settings(this).GetCachedSize(), target, stream);
   }
 
+  // .proto_serialization.RouterPartition router_partition = 6;
+  if (this->_internal_has_router_partition()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::router_partition(this),
+        _Internal::router_partition(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_serialization.NameIndex stops_index = 7;
+  if (this->_internal_has_stops_index()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::stops_index(this),
+        _Internal::stops_index(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_serialization.NameIndex routes_index = 8;
+  if (this->_internal_has_routes_index()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::routes_index(this),
+        _Internal::routes_index(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated bytes region_names = 9;
+  for (int i = 0, n = this->_internal_region_names_size(); i < n; i++) {
+    const auto& s = this->_internal_region_names(i);
+    target = stream->WriteBytes(9, s, target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1484,6 +1941,14 @@ size_t TransportCatalogue::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated bytes region_names = 9;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.region_names_.size());
+  for (int i = 0, n = _impl_.region_names_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.region_names_.Get(i));
+  }
+
   // .proto_serialization.RendererSettings renderer_settings = 4;
   if (this->_internal_has_renderer_settings()) {
     total_size += 1 +
@@ -1498,6 +1963,27 @@ size_t TransportCatalogue::ByteSizeLong() const {
         *_impl_.router_settings_);
   }
 
+  // .proto_serialization.RouterPartition router_partition = 6;
+  if (this->_internal_has_router_partition()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.router_partition_);
+  }
+
+  // .proto_serialization.NameIndex stops_index = 7;
+  if (this->_internal_has_stops_index()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.stops_index_);
+  }
+
+  // .proto_serialization.NameIndex routes_index = 8;
+  if (this->_internal_has_routes_index()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.routes_index_);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1519,6 +2005,7 @@ void TransportCatalogue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
   _this->_impl_.routes_.MergeFrom(from._impl_.routes_);
   _this->_impl_.distances_.MergeFrom(from._impl_.distances_);
+  _this->_impl_.region_names_.MergeFrom(from._impl_.region_names_);
   if (from._internal_has_renderer_settings()) {
     _this->_internal_mutable_renderer_settings()->::proto_serialization::RendererSettings::MergeFrom(
         from._internal_renderer_settings());
@@ -1527,6 +2014,18 @@ void TransportCatalogue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
     _this->_internal_mutable_router_settings()->::proto_serialization::RouterSettings::MergeFrom(
         from._internal_router_settings());
   }
+  if (from._internal_has_router_partition()) {
+    _this->_internal_mutable_router_partition()->::proto_serialization::RouterPartition::MergeFrom(
+        from._internal_router_partition());
+  }
+  if (from._internal_has_stops_index()) {
+    _this->_internal_mutable_stops_index()->::proto_serialization::NameIndex::MergeFrom(
+        from._internal_stops_index());
+  }
+  if (from._internal_has_routes_index()) {
+    _this->_internal_mutable_routes_index()->::proto_serialization::NameIndex::MergeFrom(
+        from._internal_routes_index());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1547,9 +2046,10 @@ void TransportCatalogue::InternalSwap(TransportCatalogue* other) {
   _impl_.stops_.InternalSwap(&other->_impl_.stops_);
   _impl_.routes_.InternalSwap(&other->_impl_.routes_);
   _impl_.distances_.InternalSwap(&other->_impl_.distances_);
+  _impl_.region_names_.InternalSwap(&other->_impl_.region_names_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TransportCatalogue, _impl_.router_settings_)
-      + sizeof(TransportCatalogue::_impl_.router_settings_)
+      PROTOBUF_FIELD_OFFSET(TransportCatalogue, _impl_.routes_index_)
+      + sizeof(TransportCatalogue::_impl_.routes_index_)
       - PROTOBUF_FIELD_OFFSET(TransportCatalogue, _impl_.renderer_settings_)>(
           reinterpret_cast<char*>(&_impl_.renderer_settings_),
           reinterpret_cast<char*>(&other->_impl_.renderer_settings_));
@@ -1558,7 +2058,7 @@ void TransportCatalogue::InternalSwap(TransportCatalogue* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata TransportCatalogue::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
-      file_level_metadata_transport_5fcatalogue_2eproto[4]);
+      file_level_metadata_transport_5fcatalogue_2eproto[5]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1580,6 +2080,10 @@ template<> PROTOBUF_NOINLINE ::proto_serialization::Route*
 Arena::CreateMaybeMessage< ::proto_serialization::Route >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto_serialization::Route >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proto_serialization::NameIndex*
+Arena::CreateMaybeMessage< ::proto_serialization::NameIndex >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_serialization::NameIndex >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proto_serialization::TransportCatalogue*
 Arena::CreateMaybeMessage< ::proto_serialization::TransportCatalogue >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto_serialization::TransportCatalogue >(arena);
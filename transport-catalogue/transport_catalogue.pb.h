@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021001 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -53,6 +53,9 @@ extern CoordinatesDefaultTypeInternal _Coordinates_default_instance_;
 class Distance;
 struct DistanceDefaultTypeInternal;
 extern DistanceDefaultTypeInternal _Distance_default_instance_;
+class NameIndex;
+struct NameIndexDefaultTypeInternal;
+extern NameIndexDefaultTypeInternal _NameIndex_default_instance_;
 class Route;
 struct RouteDefaultTypeInternal;
 extern RouteDefaultTypeInternal _Route_default_instance_;
@@ -66,6 +69,7 @@ extern TransportCatalogueDefaultTypeInternal _TransportCatalogue_default_instanc
 PROTOBUF_NAMESPACE_OPEN
 template<> ::proto_serialization::Coordinates* Arena::CreateMaybeMessage<::proto_serialization::Coordinates>(Arena*);
 template<> ::proto_serialization::Distance* Arena::CreateMaybeMessage<::proto_serialization::Distance>(Arena*);
+template<> ::proto_serialization::NameIndex* Arena::CreateMaybeMessage<::proto_serialization::NameIndex>(Arena*);
 template<> ::proto_serialization::Route* Arena::CreateMaybeMessage<::proto_serialization::Route>(Arena*);
 template<> ::proto_serialization::Stop* Arena::CreateMaybeMessage<::proto_serialization::Stop>(Arena*);
 template<> ::proto_serialization::TransportCatalogue* Arena::CreateMaybeMessage<::proto_serialization::TransportCatalogue>(Arena*);
@@ -356,6 +360,7 @@ class Stop final :
   enum : int {
     kNameFieldNumber = 1,
     kCoordsFieldNumber = 2,
+    kIsBoundaryFieldNumber = 3,
   };
   // bytes name = 1;
   void clear_name();
@@ -389,6 +394,15 @@ class Stop final :
       ::proto_serialization::Coordinates* coords);
   ::proto_serialization::Coordinates* unsafe_arena_release_coords();
 
+  // bool is_boundary = 3;
+  void clear_is_boundary();
+  bool is_boundary() const;
+  void set_is_boundary(bool value);
+  private:
+  bool _internal_is_boundary() const;
+  void _internal_set_is_boundary(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto_serialization.Stop)
  private:
   class _Internal;
@@ -399,6 +413,7 @@ class Stop final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::proto_serialization::Coordinates* coords_;
+    bool is_boundary_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -527,38 +542,10 @@ class Distance final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFromFieldNumber = 1,
-    kToFieldNumber = 2,
     kDistanceFieldNumber = 3,
+    kStopFromFieldNumber = 4,
+    kStopToFieldNumber = 5,
   };
-  // bytes from = 1;
-  void clear_from();
-  const std::string& from() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_from(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_from();
-  PROTOBUF_NODISCARD std::string* release_from();
-  void set_allocated_from(std::string* from);
-  private:
-  const std::string& _internal_from() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from(const std::string& value);
-  std::string* _internal_mutable_from();
-  public:
-
-  // bytes to = 2;
-  void clear_to();
-  const std::string& to() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_to(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_to();
-  PROTOBUF_NODISCARD std::string* release_to();
-  void set_allocated_to(std::string* to);
-  private:
-  const std::string& _internal_to() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_to(const std::string& value);
-  std::string* _internal_mutable_to();
-  public:
-
   // uint32 distance = 3;
   void clear_distance();
   uint32_t distance() const;
@@ -568,6 +555,24 @@ class Distance final :
   void _internal_set_distance(uint32_t value);
   public:
 
+  // uint32 stop_from = 4;
+  void clear_stop_from();
+  uint32_t stop_from() const;
+  void set_stop_from(uint32_t value);
+  private:
+  uint32_t _internal_stop_from() const;
+  void _internal_set_stop_from(uint32_t value);
+  public:
+
+  // uint32 stop_to = 5;
+  void clear_stop_to();
+  uint32_t stop_to() const;
+  void set_stop_to(uint32_t value);
+  private:
+  uint32_t _internal_stop_to() const;
+  void _internal_set_stop_to(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto_serialization.Distance)
  private:
   class _Internal;
@@ -576,9 +581,9 @@ class Distance final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr to_;
     uint32_t distance_;
+    uint32_t stop_from_;
+    uint32_t stop_to_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -707,27 +712,32 @@ class Route final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kStopsFieldNumber = 2,
+    kStopIdsFieldNumber = 4,
     kRouteNameFieldNumber = 1,
     kIsCircularFieldNumber = 3,
+    kRegionFieldNumber = 5,
   };
-  // repeated .proto_serialization.Stop stops = 2;
-  int stops_size() const;
+  // repeated uint32 stop_ids = 4;
+  int stop_ids_size() const;
   private:
-  int _internal_stops_size() const;
+  int _internal_stop_ids_size() const;
   public:
-  void clear_stops();
-  ::proto_serialization::Stop* mutable_stops(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Stop >*
-      mutable_stops();
+  void clear_stop_ids();
   private:
-  const ::proto_serialization::Stop& _internal_stops(int index) const;
-  ::proto_serialization::Stop* _internal_add_stops();
+  uint32_t _internal_stop_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_stop_ids() const;
+  void _internal_add_stop_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_stop_ids();
   public:
-  const ::proto_serialization::Stop& stops(int index) const;
-  ::proto_serialization::Stop* add_stops();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Stop >&
-      stops() const;
+  uint32_t stop_ids(int index) const;
+  void set_stop_ids(int index, uint32_t value);
+  void add_stop_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      stop_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_stop_ids();
 
   // bytes route_name = 1;
   void clear_route_name();
@@ -752,6 +762,15 @@ class Route final :
   void _internal_set_is_circular(bool value);
   public:
 
+  // uint32 region = 5;
+  void clear_region();
+  uint32_t region() const;
+  void set_region(uint32_t value);
+  private:
+  uint32_t _internal_region() const;
+  void _internal_set_region(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto_serialization.Route)
  private:
   class _Internal;
@@ -760,9 +779,195 @@ class Route final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Stop > stops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > stop_ids_;
+    mutable std::atomic<int> _stop_ids_cached_byte_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr route_name_;
     bool is_circular_;
+    uint32_t region_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NameIndex final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_serialization.NameIndex) */ {
+ public:
+  inline NameIndex() : NameIndex(nullptr) {}
+  ~NameIndex() override;
+  explicit PROTOBUF_CONSTEXPR NameIndex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NameIndex(const NameIndex& from);
+  NameIndex(NameIndex&& from) noexcept
+    : NameIndex() {
+    *this = ::std::move(from);
+  }
+
+  inline NameIndex& operator=(const NameIndex& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NameIndex& operator=(NameIndex&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NameIndex& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NameIndex* internal_default_instance() {
+    return reinterpret_cast<const NameIndex*>(
+               &_NameIndex_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(NameIndex& a, NameIndex& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NameIndex* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NameIndex* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NameIndex* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NameIndex>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NameIndex& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NameIndex& from) {
+    NameIndex::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NameIndex* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_serialization.NameIndex";
+  }
+  protected:
+  explicit NameIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDisplacementsFieldNumber = 3,
+    kSeedFieldNumber = 1,
+    kKeysCountFieldNumber = 2,
+  };
+  // repeated uint32 displacements = 3;
+  int displacements_size() const;
+  private:
+  int _internal_displacements_size() const;
+  public:
+  void clear_displacements();
+  private:
+  uint32_t _internal_displacements(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_displacements() const;
+  void _internal_add_displacements(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_displacements();
+  public:
+  uint32_t displacements(int index) const;
+  void set_displacements(int index, uint32_t value);
+  void add_displacements(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      displacements() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_displacements();
+
+  // uint64 seed = 1;
+  void clear_seed();
+  uint64_t seed() const;
+  void set_seed(uint64_t value);
+  private:
+  uint64_t _internal_seed() const;
+  void _internal_set_seed(uint64_t value);
+  public:
+
+  // uint32 keys_count = 2;
+  void clear_keys_count();
+  uint32_t keys_count() const;
+  void set_keys_count(uint32_t value);
+  private:
+  uint32_t _internal_keys_count() const;
+  void _internal_set_keys_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_serialization.NameIndex)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > displacements_;
+    mutable std::atomic<int> _displacements_cached_byte_size_;
+    uint64_t seed_;
+    uint32_t keys_count_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -818,7 +1023,7 @@ class TransportCatalogue final :
                &_TransportCatalogue_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(TransportCatalogue& a, TransportCatalogue& b) {
     a.Swap(&b);
@@ -894,8 +1099,12 @@ class TransportCatalogue final :
     kStopsFieldNumber = 1,
     kRoutesFieldNumber = 2,
     kDistancesFieldNumber = 3,
+    kRegionNamesFieldNumber = 9,
     kRendererSettingsFieldNumber = 4,
     kRouterSettingsFieldNumber = 5,
+    kRouterPartitionFieldNumber = 6,
+    kStopsIndexFieldNumber = 7,
+    kRoutesIndexFieldNumber = 8,
   };
   // repeated .proto_serialization.Stop stops = 1;
   int stops_size() const;
@@ -951,6 +1160,30 @@ class TransportCatalogue final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Distance >&
       distances() const;
 
+  // repeated bytes region_names = 9;
+  int region_names_size() const;
+  private:
+  int _internal_region_names_size() const;
+  public:
+  void clear_region_names();
+  const std::string& region_names(int index) const;
+  std::string* mutable_region_names(int index);
+  void set_region_names(int index, const std::string& value);
+  void set_region_names(int index, std::string&& value);
+  void set_region_names(int index, const char* value);
+  void set_region_names(int index, const void* value, size_t size);
+  std::string* add_region_names();
+  void add_region_names(const std::string& value);
+  void add_region_names(std::string&& value);
+  void add_region_names(const char* value);
+  void add_region_names(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& region_names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_region_names();
+  private:
+  const std::string& _internal_region_names(int index) const;
+  std::string* _internal_add_region_names();
+  public:
+
   // .proto_serialization.RendererSettings renderer_settings = 4;
   bool has_renderer_settings() const;
   private:
@@ -987,6 +1220,60 @@ class TransportCatalogue final :
       ::proto_serialization::RouterSettings* router_settings);
   ::proto_serialization::RouterSettings* unsafe_arena_release_router_settings();
 
+  // .proto_serialization.RouterPartition router_partition = 6;
+  bool has_router_partition() const;
+  private:
+  bool _internal_has_router_partition() const;
+  public:
+  void clear_router_partition();
+  const ::proto_serialization::RouterPartition& router_partition() const;
+  PROTOBUF_NODISCARD ::proto_serialization::RouterPartition* release_router_partition();
+  ::proto_serialization::RouterPartition* mutable_router_partition();
+  void set_allocated_router_partition(::proto_serialization::RouterPartition* router_partition);
+  private:
+  const ::proto_serialization::RouterPartition& _internal_router_partition() const;
+  ::proto_serialization::RouterPartition* _internal_mutable_router_partition();
+  public:
+  void unsafe_arena_set_allocated_router_partition(
+      ::proto_serialization::RouterPartition* router_partition);
+  ::proto_serialization::RouterPartition* unsafe_arena_release_router_partition();
+
+  // .proto_serialization.NameIndex stops_index = 7;
+  bool has_stops_index() const;
+  private:
+  bool _internal_has_stops_index() const;
+  public:
+  void clear_stops_index();
+  const ::proto_serialization::NameIndex& stops_index() const;
+  PROTOBUF_NODISCARD ::proto_serialization::NameIndex* release_stops_index();
+  ::proto_serialization::NameIndex* mutable_stops_index();
+  void set_allocated_stops_index(::proto_serialization::NameIndex* stops_index);
+  private:
+  const ::proto_serialization::NameIndex& _internal_stops_index() const;
+  ::proto_serialization::NameIndex* _internal_mutable_stops_index();
+  public:
+  void unsafe_arena_set_allocated_stops_index(
+      ::proto_serialization::NameIndex* stops_index);
+  ::proto_serialization::NameIndex* unsafe_arena_release_stops_index();
+
+  // .proto_serialization.NameIndex routes_index = 8;
+  bool has_routes_index() const;
+  private:
+  bool _internal_has_routes_index() const;
+  public:
+  void clear_routes_index();
+  const ::proto_serialization::NameIndex& routes_index() const;
+  PROTOBUF_NODISCARD ::proto_serialization::NameIndex* release_routes_index();
+  ::proto_serialization::NameIndex* mutable_routes_index();
+  void set_allocated_routes_index(::proto_serialization::NameIndex* routes_index);
+  private:
+  const ::proto_serialization::NameIndex& _internal_routes_index() const;
+  ::proto_serialization::NameIndex* _internal_mutable_routes_index();
+  public:
+  void unsafe_arena_set_allocated_routes_index(
+      ::proto_serialization::NameIndex* routes_index);
+  ::proto_serialization::NameIndex* unsafe_arena_release_routes_index();
+
   // @@protoc_insertion_point(class_scope:proto_serialization.TransportCatalogue)
  private:
   class _Internal;
@@ -998,8 +1285,12 @@ class TransportCatalogue final :
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Stop > stops_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Route > routes_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Distance > distances_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> region_names_;
     ::proto_serialization::RendererSettings* renderer_settings_;
     ::proto_serialization::RouterSettings* router_settings_;
+    ::proto_serialization::RouterPartition* router_partition_;
+    ::proto_serialization::NameIndex* stops_index_;
+    ::proto_serialization::NameIndex* routes_index_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1200,108 +1491,68 @@ inline void Stop::set_allocated_coords(::proto_serialization::Coordinates* coord
   // @@protoc_insertion_point(field_set_allocated:proto_serialization.Stop.coords)
 }
 
-// -------------------------------------------------------------------
-
-// Distance
-
-// bytes from = 1;
-inline void Distance::clear_from() {
-  _impl_.from_.ClearToEmpty();
+// bool is_boundary = 3;
+inline void Stop::clear_is_boundary() {
+  _impl_.is_boundary_ = false;
 }
-inline const std::string& Distance::from() const {
-  // @@protoc_insertion_point(field_get:proto_serialization.Distance.from)
-  return _internal_from();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Distance::set_from(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.from_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto_serialization.Distance.from)
-}
-inline std::string* Distance::mutable_from() {
-  std::string* _s = _internal_mutable_from();
-  // @@protoc_insertion_point(field_mutable:proto_serialization.Distance.from)
-  return _s;
+inline bool Stop::_internal_is_boundary() const {
+  return _impl_.is_boundary_;
 }
-inline const std::string& Distance::_internal_from() const {
-  return _impl_.from_.Get();
+inline bool Stop::is_boundary() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.Stop.is_boundary)
+  return _internal_is_boundary();
 }
-inline void Distance::_internal_set_from(const std::string& value) {
+inline void Stop::_internal_set_is_boundary(bool value) {
   
-  _impl_.from_.Set(value, GetArenaForAllocation());
+  _impl_.is_boundary_ = value;
 }
-inline std::string* Distance::_internal_mutable_from() {
-  
-  return _impl_.from_.Mutable(GetArenaForAllocation());
+inline void Stop::set_is_boundary(bool value) {
+  _internal_set_is_boundary(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.Stop.is_boundary)
 }
-inline std::string* Distance::release_from() {
-  // @@protoc_insertion_point(field_release:proto_serialization.Distance.from)
-  return _impl_.from_.Release();
+
+// -------------------------------------------------------------------
+
+// Distance
+
+// uint32 stop_from = 4;
+inline void Distance::clear_stop_from() {
+  _impl_.stop_from_ = 0u;
 }
-inline void Distance::set_allocated_from(std::string* from) {
-  if (from != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.from_.SetAllocated(from, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.from_.IsDefault()) {
-    _impl_.from_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto_serialization.Distance.from)
+inline uint32_t Distance::_internal_stop_from() const {
+  return _impl_.stop_from_;
 }
-
-// bytes to = 2;
-inline void Distance::clear_to() {
-  _impl_.to_.ClearToEmpty();
+inline uint32_t Distance::stop_from() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.Distance.stop_from)
+  return _internal_stop_from();
 }
-inline const std::string& Distance::to() const {
-  // @@protoc_insertion_point(field_get:proto_serialization.Distance.to)
-  return _internal_to();
+inline void Distance::_internal_set_stop_from(uint32_t value) {
+  
+  _impl_.stop_from_ = value;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Distance::set_to(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.to_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto_serialization.Distance.to)
+inline void Distance::set_stop_from(uint32_t value) {
+  _internal_set_stop_from(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.Distance.stop_from)
 }
-inline std::string* Distance::mutable_to() {
-  std::string* _s = _internal_mutable_to();
-  // @@protoc_insertion_point(field_mutable:proto_serialization.Distance.to)
-  return _s;
+
+// uint32 stop_to = 5;
+inline void Distance::clear_stop_to() {
+  _impl_.stop_to_ = 0u;
 }
-inline const std::string& Distance::_internal_to() const {
-  return _impl_.to_.Get();
+inline uint32_t Distance::_internal_stop_to() const {
+  return _impl_.stop_to_;
 }
-inline void Distance::_internal_set_to(const std::string& value) {
-  
-  _impl_.to_.Set(value, GetArenaForAllocation());
+inline uint32_t Distance::stop_to() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.Distance.stop_to)
+  return _internal_stop_to();
 }
-inline std::string* Distance::_internal_mutable_to() {
+inline void Distance::_internal_set_stop_to(uint32_t value) {
   
-  return _impl_.to_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Distance::release_to() {
-  // @@protoc_insertion_point(field_release:proto_serialization.Distance.to)
-  return _impl_.to_.Release();
+  _impl_.stop_to_ = value;
 }
-inline void Distance::set_allocated_to(std::string* to) {
-  if (to != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.to_.SetAllocated(to, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.to_.IsDefault()) {
-    _impl_.to_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto_serialization.Distance.to)
+inline void Distance::set_stop_to(uint32_t value) {
+  _internal_set_stop_to(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.Distance.stop_to)
 }
 
 // uint32 distance = 3;
@@ -1378,44 +1629,51 @@ inline void Route::set_allocated_route_name(std::string* route_name) {
   // @@protoc_insertion_point(field_set_allocated:proto_serialization.Route.route_name)
 }
 
-// repeated .proto_serialization.Stop stops = 2;
-inline int Route::_internal_stops_size() const {
-  return _impl_.stops_.size();
+// repeated uint32 stop_ids = 4;
+inline int Route::_internal_stop_ids_size() const {
+  return _impl_.stop_ids_.size();
 }
-inline int Route::stops_size() const {
-  return _internal_stops_size();
+inline int Route::stop_ids_size() const {
+  return _internal_stop_ids_size();
 }
-inline void Route::clear_stops() {
-  _impl_.stops_.Clear();
+inline void Route::clear_stop_ids() {
+  _impl_.stop_ids_.Clear();
 }
-inline ::proto_serialization::Stop* Route::mutable_stops(int index) {
-  // @@protoc_insertion_point(field_mutable:proto_serialization.Route.stops)
-  return _impl_.stops_.Mutable(index);
+inline uint32_t Route::_internal_stop_ids(int index) const {
+  return _impl_.stop_ids_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Stop >*
-Route::mutable_stops() {
-  // @@protoc_insertion_point(field_mutable_list:proto_serialization.Route.stops)
-  return &_impl_.stops_;
+inline uint32_t Route::stop_ids(int index) const {
+  // @@protoc_insertion_point(field_get:proto_serialization.Route.stop_ids)
+  return _internal_stop_ids(index);
 }
-inline const ::proto_serialization::Stop& Route::_internal_stops(int index) const {
-  return _impl_.stops_.Get(index);
+inline void Route::set_stop_ids(int index, uint32_t value) {
+  _impl_.stop_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_serialization.Route.stop_ids)
 }
-inline const ::proto_serialization::Stop& Route::stops(int index) const {
-  // @@protoc_insertion_point(field_get:proto_serialization.Route.stops)
-  return _internal_stops(index);
+inline void Route::_internal_add_stop_ids(uint32_t value) {
+  _impl_.stop_ids_.Add(value);
 }
-inline ::proto_serialization::Stop* Route::_internal_add_stops() {
-  return _impl_.stops_.Add();
+inline void Route::add_stop_ids(uint32_t value) {
+  _internal_add_stop_ids(value);
+  // @@protoc_insertion_point(field_add:proto_serialization.Route.stop_ids)
 }
-inline ::proto_serialization::Stop* Route::add_stops() {
-  ::proto_serialization::Stop* _add = _internal_add_stops();
-  // @@protoc_insertion_point(field_add:proto_serialization.Route.stops)
-  return _add;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Route::_internal_stop_ids() const {
+  return _impl_.stop_ids_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::Stop >&
-Route::stops() const {
-  // @@protoc_insertion_point(field_list:proto_serialization.Route.stops)
-  return _impl_.stops_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Route::stop_ids() const {
+  // @@protoc_insertion_point(field_list:proto_serialization.Route.stop_ids)
+  return _internal_stop_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Route::_internal_mutable_stop_ids() {
+  return &_impl_.stop_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Route::mutable_stop_ids() {
+  // @@protoc_insertion_point(field_mutable_list:proto_serialization.Route.stop_ids)
+  return _internal_mutable_stop_ids();
 }
 
 // bool is_circular = 3;
@@ -1438,6 +1696,117 @@ inline void Route::set_is_circular(bool value) {
   // @@protoc_insertion_point(field_set:proto_serialization.Route.is_circular)
 }
 
+// uint32 region = 5;
+inline void Route::clear_region() {
+  _impl_.region_ = 0u;
+}
+inline uint32_t Route::_internal_region() const {
+  return _impl_.region_;
+}
+inline uint32_t Route::region() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.Route.region)
+  return _internal_region();
+}
+inline void Route::_internal_set_region(uint32_t value) {
+  
+  _impl_.region_ = value;
+}
+inline void Route::set_region(uint32_t value) {
+  _internal_set_region(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.Route.region)
+}
+
+// -------------------------------------------------------------------
+
+// NameIndex
+
+// uint64 seed = 1;
+inline void NameIndex::clear_seed() {
+  _impl_.seed_ = uint64_t{0u};
+}
+inline uint64_t NameIndex::_internal_seed() const {
+  return _impl_.seed_;
+}
+inline uint64_t NameIndex::seed() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.NameIndex.seed)
+  return _internal_seed();
+}
+inline void NameIndex::_internal_set_seed(uint64_t value) {
+  
+  _impl_.seed_ = value;
+}
+inline void NameIndex::set_seed(uint64_t value) {
+  _internal_set_seed(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.NameIndex.seed)
+}
+
+// uint32 keys_count = 2;
+inline void NameIndex::clear_keys_count() {
+  _impl_.keys_count_ = 0u;
+}
+inline uint32_t NameIndex::_internal_keys_count() const {
+  return _impl_.keys_count_;
+}
+inline uint32_t NameIndex::keys_count() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.NameIndex.keys_count)
+  return _internal_keys_count();
+}
+inline void NameIndex::_internal_set_keys_count(uint32_t value) {
+  
+  _impl_.keys_count_ = value;
+}
+inline void NameIndex::set_keys_count(uint32_t value) {
+  _internal_set_keys_count(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.NameIndex.keys_count)
+}
+
+// repeated uint32 displacements = 3;
+inline int NameIndex::_internal_displacements_size() const {
+  return _impl_.displacements_.size();
+}
+inline int NameIndex::displacements_size() const {
+  return _internal_displacements_size();
+}
+inline void NameIndex::clear_displacements() {
+  _impl_.displacements_.Clear();
+}
+inline uint32_t NameIndex::_internal_displacements(int index) const {
+  return _impl_.displacements_.Get(index);
+}
+inline uint32_t NameIndex::displacements(int index) const {
+  // @@protoc_insertion_point(field_get:proto_serialization.NameIndex.displacements)
+  return _internal_displacements(index);
+}
+inline void NameIndex::set_displacements(int index, uint32_t value) {
+  _impl_.displacements_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_serialization.NameIndex.displacements)
+}
+inline void NameIndex::_internal_add_displacements(uint32_t value) {
+  _impl_.displacements_.Add(value);
+}
+inline void NameIndex::add_displacements(uint32_t value) {
+  _internal_add_displacements(value);
+  // @@protoc_insertion_point(field_add:proto_serialization.NameIndex.displacements)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+NameIndex::_internal_displacements() const {
+  return _impl_.displacements_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+NameIndex::displacements() const {
+  // @@protoc_insertion_point(field_list:proto_serialization.NameIndex.displacements)
+  return _internal_displacements();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+NameIndex::_internal_mutable_displacements() {
+  return &_impl_.displacements_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+NameIndex::mutable_displacements() {
+  // @@protoc_insertion_point(field_mutable_list:proto_serialization.NameIndex.displacements)
+  return _internal_mutable_displacements();
+}
+
 // -------------------------------------------------------------------
 
 // TransportCatalogue
@@ -1732,6 +2101,346 @@ inline void TransportCatalogue::set_allocated_router_settings(::proto_serializat
   // @@protoc_insertion_point(field_set_allocated:proto_serialization.TransportCatalogue.router_settings)
 }
 
+// .proto_serialization.RouterPartition router_partition = 6;
+inline bool TransportCatalogue::_internal_has_router_partition() const {
+  return this != internal_default_instance() && _impl_.router_partition_ != nullptr;
+}
+inline bool TransportCatalogue::has_router_partition() const {
+  return _internal_has_router_partition();
+}
+inline const ::proto_serialization::RouterPartition& TransportCatalogue::_internal_router_partition() const {
+  const ::proto_serialization::RouterPartition* p = _impl_.router_partition_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_serialization::RouterPartition&>(
+      ::proto_serialization::_RouterPartition_default_instance_);
+}
+inline const ::proto_serialization::RouterPartition& TransportCatalogue::router_partition() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.TransportCatalogue.router_partition)
+  return _internal_router_partition();
+}
+inline void TransportCatalogue::unsafe_arena_set_allocated_router_partition(
+    ::proto_serialization::RouterPartition* router_partition) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_partition_);
+  }
+  _impl_.router_partition_ = router_partition;
+  if (router_partition) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_serialization.TransportCatalogue.router_partition)
+}
+inline ::proto_serialization::RouterPartition* TransportCatalogue::release_router_partition() {
+  
+  ::proto_serialization::RouterPartition* temp = _impl_.router_partition_;
+  _impl_.router_partition_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_serialization::RouterPartition* TransportCatalogue::unsafe_arena_release_router_partition() {
+  // @@protoc_insertion_point(field_release:proto_serialization.TransportCatalogue.router_partition)
+  
+  ::proto_serialization::RouterPartition* temp = _impl_.router_partition_;
+  _impl_.router_partition_ = nullptr;
+  return temp;
+}
+inline ::proto_serialization::RouterPartition* TransportCatalogue::_internal_mutable_router_partition() {
+  
+  if (_impl_.router_partition_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_serialization::RouterPartition>(GetArenaForAllocation());
+    _impl_.router_partition_ = p;
+  }
+  return _impl_.router_partition_;
+}
+inline ::proto_serialization::RouterPartition* TransportCatalogue::mutable_router_partition() {
+  ::proto_serialization::RouterPartition* _msg = _internal_mutable_router_partition();
+  // @@protoc_insertion_point(field_mutable:proto_serialization.TransportCatalogue.router_partition)
+  return _msg;
+}
+inline void TransportCatalogue::set_allocated_router_partition(::proto_serialization::RouterPartition* router_partition) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_partition_);
+  }
+  if (router_partition) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_partition));
+    if (message_arena != submessage_arena) {
+      router_partition = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, router_partition, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.router_partition_ = router_partition;
+  // @@protoc_insertion_point(field_set_allocated:proto_serialization.TransportCatalogue.router_partition)
+}
+
+// .proto_serialization.NameIndex stops_index = 7;
+inline bool TransportCatalogue::_internal_has_stops_index() const {
+  return this != internal_default_instance() && _impl_.stops_index_ != nullptr;
+}
+inline bool TransportCatalogue::has_stops_index() const {
+  return _internal_has_stops_index();
+}
+inline void TransportCatalogue::clear_stops_index() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stops_index_ != nullptr) {
+    delete _impl_.stops_index_;
+  }
+  _impl_.stops_index_ = nullptr;
+}
+inline const ::proto_serialization::NameIndex& TransportCatalogue::_internal_stops_index() const {
+  const ::proto_serialization::NameIndex* p = _impl_.stops_index_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_serialization::NameIndex&>(
+      ::proto_serialization::_NameIndex_default_instance_);
+}
+inline const ::proto_serialization::NameIndex& TransportCatalogue::stops_index() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.TransportCatalogue.stops_index)
+  return _internal_stops_index();
+}
+inline void TransportCatalogue::unsafe_arena_set_allocated_stops_index(
+    ::proto_serialization::NameIndex* stops_index) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stops_index_);
+  }
+  _impl_.stops_index_ = stops_index;
+  if (stops_index) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_serialization.TransportCatalogue.stops_index)
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::release_stops_index() {
+  
+  ::proto_serialization::NameIndex* temp = _impl_.stops_index_;
+  _impl_.stops_index_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::unsafe_arena_release_stops_index() {
+  // @@protoc_insertion_point(field_release:proto_serialization.TransportCatalogue.stops_index)
+  
+  ::proto_serialization::NameIndex* temp = _impl_.stops_index_;
+  _impl_.stops_index_ = nullptr;
+  return temp;
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::_internal_mutable_stops_index() {
+  
+  if (_impl_.stops_index_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_serialization::NameIndex>(GetArenaForAllocation());
+    _impl_.stops_index_ = p;
+  }
+  return _impl_.stops_index_;
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::mutable_stops_index() {
+  ::proto_serialization::NameIndex* _msg = _internal_mutable_stops_index();
+  // @@protoc_insertion_point(field_mutable:proto_serialization.TransportCatalogue.stops_index)
+  return _msg;
+}
+inline void TransportCatalogue::set_allocated_stops_index(::proto_serialization::NameIndex* stops_index) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stops_index_;
+  }
+  if (stops_index) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stops_index);
+    if (message_arena != submessage_arena) {
+      stops_index = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stops_index, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stops_index_ = stops_index;
+  // @@protoc_insertion_point(field_set_allocated:proto_serialization.TransportCatalogue.stops_index)
+}
+
+// .proto_serialization.NameIndex routes_index = 8;
+inline bool TransportCatalogue::_internal_has_routes_index() const {
+  return this != internal_default_instance() && _impl_.routes_index_ != nullptr;
+}
+inline bool TransportCatalogue::has_routes_index() const {
+  return _internal_has_routes_index();
+}
+inline void TransportCatalogue::clear_routes_index() {
+  if (GetArenaForAllocation() == nullptr && _impl_.routes_index_ != nullptr) {
+    delete _impl_.routes_index_;
+  }
+  _impl_.routes_index_ = nullptr;
+}
+inline const ::proto_serialization::NameIndex& TransportCatalogue::_internal_routes_index() const {
+  const ::proto_serialization::NameIndex* p = _impl_.routes_index_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_serialization::NameIndex&>(
+      ::proto_serialization::_NameIndex_default_instance_);
+}
+inline const ::proto_serialization::NameIndex& TransportCatalogue::routes_index() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.TransportCatalogue.routes_index)
+  return _internal_routes_index();
+}
+inline void TransportCatalogue::unsafe_arena_set_allocated_routes_index(
+    ::proto_serialization::NameIndex* routes_index) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routes_index_);
+  }
+  _impl_.routes_index_ = routes_index;
+  if (routes_index) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_serialization.TransportCatalogue.routes_index)
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::release_routes_index() {
+  
+  ::proto_serialization::NameIndex* temp = _impl_.routes_index_;
+  _impl_.routes_index_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::unsafe_arena_release_routes_index() {
+  // @@protoc_insertion_point(field_release:proto_serialization.TransportCatalogue.routes_index)
+  
+  ::proto_serialization::NameIndex* temp = _impl_.routes_index_;
+  _impl_.routes_index_ = nullptr;
+  return temp;
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::_internal_mutable_routes_index() {
+  
+  if (_impl_.routes_index_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_serialization::NameIndex>(GetArenaForAllocation());
+    _impl_.routes_index_ = p;
+  }
+  return _impl_.routes_index_;
+}
+inline ::proto_serialization::NameIndex* TransportCatalogue::mutable_routes_index() {
+  ::proto_serialization::NameIndex* _msg = _internal_mutable_routes_index();
+  // @@protoc_insertion_point(field_mutable:proto_serialization.TransportCatalogue.routes_index)
+  return _msg;
+}
+inline void TransportCatalogue::set_allocated_routes_index(::proto_serialization::NameIndex* routes_index) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.routes_index_;
+  }
+  if (routes_index) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(routes_index);
+    if (message_arena != submessage_arena) {
+      routes_index = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, routes_index, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.routes_index_ = routes_index;
+  // @@protoc_insertion_point(field_set_allocated:proto_serialization.TransportCatalogue.routes_index)
+}
+
+// repeated bytes region_names = 9;
+inline int TransportCatalogue::_internal_region_names_size() const {
+  return _impl_.region_names_.size();
+}
+inline int TransportCatalogue::region_names_size() const {
+  return _internal_region_names_size();
+}
+inline void TransportCatalogue::clear_region_names() {
+  _impl_.region_names_.Clear();
+}
+inline std::string* TransportCatalogue::add_region_names() {
+  std::string* _s = _internal_add_region_names();
+  // @@protoc_insertion_point(field_add_mutable:proto_serialization.TransportCatalogue.region_names)
+  return _s;
+}
+inline const std::string& TransportCatalogue::_internal_region_names(int index) const {
+  return _impl_.region_names_.Get(index);
+}
+inline const std::string& TransportCatalogue::region_names(int index) const {
+  // @@protoc_insertion_point(field_get:proto_serialization.TransportCatalogue.region_names)
+  return _internal_region_names(index);
+}
+inline std::string* TransportCatalogue::mutable_region_names(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_serialization.TransportCatalogue.region_names)
+  return _impl_.region_names_.Mutable(index);
+}
+inline void TransportCatalogue::set_region_names(int index, const std::string& value) {
+  _impl_.region_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.TransportCatalogue.region_names)
+}
+inline void TransportCatalogue::set_region_names(int index, std::string&& value) {
+  _impl_.region_names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:proto_serialization.TransportCatalogue.region_names)
+}
+inline void TransportCatalogue::set_region_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.region_names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:proto_serialization.TransportCatalogue.region_names)
+}
+inline void TransportCatalogue::set_region_names(int index, const void* value, size_t size) {
+  _impl_.region_names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:proto_serialization.TransportCatalogue.region_names)
+}
+inline std::string* TransportCatalogue::_internal_add_region_names() {
+  return _impl_.region_names_.Add();
+}
+inline void TransportCatalogue::add_region_names(const std::string& value) {
+  _impl_.region_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:proto_serialization.TransportCatalogue.region_names)
+}
+inline void TransportCatalogue::add_region_names(std::string&& value) {
+  _impl_.region_names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:proto_serialization.TransportCatalogue.region_names)
+}
+inline void TransportCatalogue::add_region_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.region_names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:proto_serialization.TransportCatalogue.region_names)
+}
+inline void TransportCatalogue::add_region_names(const void* value, size_t size) {
+  _impl_.region_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:proto_serialization.TransportCatalogue.region_names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+TransportCatalogue::region_names() const {
+  // @@protoc_insertion_point(field_list:proto_serialization.TransportCatalogue.region_names)
+  return _impl_.region_names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+TransportCatalogue::mutable_region_names() {
+  // @@protoc_insertion_point(field_mutable_list:proto_serialization.TransportCatalogue.region_names)
+  return &_impl_.region_names_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1743,6 +2452,8 @@ inline void TransportCatalogue::set_allocated_router_settings(::proto_serializat
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1,12 +1,87 @@
+#define _USE_MATH_DEFINES  //   
+
 #include "transport_router.h"
 
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <stdexcept>
+
 namespace router
 {
 
+namespace
+{
+
+//        CRP (4   l    l + 1)
+const size_t CRP_LEVEL_BITS = 2;
+
+//   CRP       (-   ), 
+const double CRP_BYTES_PER_EDGE_LEVEL = 16.0;
+
+//         ,    :
+//  "" ( )    
+graph::VertexId GetWaitVertex(transport_catalogue::StopId stop_id)
+{
+	return static_cast<graph::VertexId>(stop_id) * 2;
+}
+
+graph::VertexId GetTravelVertex(transport_catalogue::StopId stop_id)
+{
+	return static_cast<graph::VertexId>(stop_id) * 2 + 1;
+}
+
+//   : ,     
+struct StopCode
+{
+	transport_catalogue::StopId id = 0;
+	geo::Coordinates coords{ 0L, 0L };
+	uint32_t code = 0;
+};
+
+//    [begin, end)     
+//  .     -    
+template <typename It>
+void BisectStops(It begin, It end, size_t depth, uint32_t code)
+{
+	if (depth == 0 || std::distance(begin, end) < 2)
+	{
+		for (auto it = begin; it != end; ++it)
+		{
+			it->code = code << depth;
+		}
+		return;
+	}
+
+	double min_lat = begin->coords.lat, max_lat = min_lat;
+	double min_lng = begin->coords.lng, max_lng = min_lng;
+	for (auto it = begin; it != end; ++it)
+	{
+		min_lat = std::min(min_lat, it->coords.lat);
+		max_lat = std::max(max_lat, it->coords.lat);
+		min_lng = std::min(min_lng, it->coords.lng);
+		max_lng = std::max(max_lng, it->coords.lng);
+	}
+	//       cos() 
+	const double lng_scale = std::cos((min_lat + max_lat) / 2.0 * M_PI / 180.0);
+	const bool by_lat = (max_lat - min_lat) >= (max_lng - min_lng) * lng_scale;
+
+	const It middle = begin + std::distance(begin, end) / 2;
+	std::nth_element(begin, middle, end, [by_lat](const auto& lhs, const auto& rhs)
+					 {
+						 return by_lat ? lhs.coords.lat < rhs.coords.lat
+							 : lhs.coords.lng < rhs.coords.lng;
+					 });
+	BisectStops(begin, middle, depth - 1, code << 1);
+	BisectStops(middle, end, depth - 1, (code << 1) | 1U);
+}
+
+} // namespace
+
 // -----------------TransportRouter-------------------------
 
-TransportRouter::TransportRouter(transport_catalogue::TransportCatalogue& tc)
-	: tc_(tc), dw_graph_(tc.GetAllStopsCount() * 2)
+TransportRouter::TransportRouter(const transport_catalogue::FrozenCatalogue& tc)
+	: tc_(&tc), dw_graph_(tc.GetStopsCount() * 2)
 {
 	//    TransportRouter     
 	//    ,   ,     .
@@ -16,7 +91,24 @@ TransportRouter::TransportRouter(transport_catalogue::TransportCatalogue& tc)
 
 void TransportRouter::ApplyRouterSettings(RouterSettings& settings)
 {
+	//      
+	WaitForBuild();
     settings_ = std::move(settings);
+	//  RAPTOR      -    
+	raptor_.reset();
+
+	if (crp_router_ && GetActiveEngine() == RouterEngine::CRP)
+	{
+		//   .     , 
+		//        
+		BuildGraph();
+		crp_router_->Customize();
+	}
+	else if (IsBuilt())
+	{
+		//        
+		ResetRouters();
+	}
 }
 
 
@@ -26,88 +118,253 @@ RouterSettings TransportRouter::GetRouterSettings() const
 }
 
 
-const RouteData TransportRouter::CalculateRoute(const std::string_view from, const std::string_view to)
+void TransportRouter::SetExpectedRouteQueries(size_t queries)
 {
+	expected_route_queries_ = std::max(queries, size_t{ 1 });
+}
 
-	//      (   ), 
-	if (!router_)
+
+void TransportRouter::SetDiagnosticsOutput(std::ostream* diagnostics)
+{
+	diagnostics_ = diagnostics;
+}
+
+
+void TransportRouter::StartBuildAsync()
+{
+	WaitForBuild();
+	if (IsBuilt())
 	{
-		BuildGraph();
+		return;
 	}
+	build_future_ = std::async(std::launch::async, [this]()
+							   {
+								   Build();
+							   });
+}
 
-	RouteData result;    //    NRVO
-	auto calculated_route = router_->BuildRoute(vertexes_wait_.at(from), vertexes_wait_.at(to));
 
-	//    optional   ?
-	if (calculated_route)
+void TransportRouter::UpdateCatalogue(const transport_catalogue::FrozenCatalogue& tc,
+									  transport_catalogue::CatalogueChanges changes)
+{
+	//      -    
+	WaitForBuild();
+	tc_ = &tc;
+	//  RAPTOR       -   
+	raptor_.reset();
+
+	if (changes.stops_added)
 	{
-		//     json
-		result.founded = true;
-		//          
-		for (const auto& element_id : calculated_route->edges)
+		//    .     
+		partition_.clear();
+		ResetRouters();
+		return;
+	}
+	if (!IsBuilt())
+	{
+		//     -         
+		return;
+	}
+	if (sharded_router_)
+	{
+		//     .     ,
+		//      
+		if (changes.distances || changes.routes || changes.regions)
 		{
-			auto edge_details = dw_graph_.GetEdge(element_id);
-			//       
-			result.total_time += edge_details.weight;
-			//           RouteItem
-			result.items.emplace_back(RouteItem{
-				edge_details.edge_name,
-				(edge_details.type == graph::EdgeType::TRAVEL) ? edge_details.span_count : 0,
-				edge_details.weight,
-				edge_details.type });
+			ResetRouters();
 		}
+		return;
+	}
+	if (changes.routes)
+	{
+		//    
+		ResetRouters();
+		return;
+	}
+
+	//   .   :     
+	BuildGraph();
+	if (changes.distances)
+	{
+		if (crp_router_)
+		{
+			//     -   
+			crp_router_->Customize();
+		}
+		else
+		{
+			router_.reset();
+		}
+	}
+	//        
+}
+
+
+void TransportRouter::WaitForBuild()
+{
+	if (build_future_.valid())
+	{
+		// get()  ,   
+		build_future_.get();
+	}
+}
+
+
+const RouteData TransportRouter::CalculateRoute(const std::string_view from, const std::string_view to,
+												std::optional<size_t> max_transfers /*= std::nullopt*/)
+{
+	RouteData result;    //    NRVO
+	const auto total_time = VisitRoute(from, to,
+		[&result](const RouteItem& item)
+		{
+			result.items.push_back(item);
+		},
+		max_transfers);
+	if (total_time)
+	{
+		//     json
+		result.founded = true;
+		result.total_time = *total_time;
 	}
 	return result;
 }
 
 
+bool TransportRouter::FindRouteEdges(const std::string_view from, const std::string_view to)
+{
+	//      -   ,     
+	WaitForBuild();
+
+	//      (   ), 
+	if (!IsBuilt())
+	{
+		Build();
+	}
+
+	if (sharded_router_)
+	{
+		//       
+		return sharded_router_->FindRoute(GetStopId(from), GetStopId(to)).has_value();
+	}
+
+	const graph::VertexId vertex_from = GetWaitVertex(GetStopId(from));
+	const graph::VertexId vertex_to = GetWaitVertex(GetStopId(to));
+
+	//     ,      
+	if (crp_router_)
+	{
+		return crp_router_->BuildRoute(vertex_from, vertex_to, edges_buffer_).has_value();
+	}
+	return router_->BuildRoute(vertex_from, vertex_to, edges_buffer_).has_value();
+}
+
+
+std::optional<double> TransportRouter::FindJourney(const std::string_view from,
+												   const std::string_view to,
+												   size_t max_transfers)
+{
+	// RAPTOR   ,        
+	if (!raptor_)
+	{
+		raptor_ = std::make_unique<Raptor>(*tc_, settings_.bus_wait_time, settings_.bus_velocity);
+	}
+	const auto stop_from = tc_->FindStop(from);
+	const auto stop_to = tc_->FindStop(to);
+	if (!stop_from || !stop_to)
+	{
+		return std::nullopt;
+	}
+	return raptor_->FindJourney(*stop_from, *stop_to, max_transfers, legs_buffer_);
+}
+
+
+transport_catalogue::StopId TransportRouter::GetStopId(const std::string_view stop_name) const
+{
+	const auto stop = tc_->FindStop(stop_name);
+	if (!stop)
+	{
+		throw std::out_of_range("Unknown stop: " + std::string(stop_name));
+	}
+	return *stop;
+}
+
+
+void TransportRouter::Build()
+{
+	if (IsSharded())
+	{
+		//     :         
+		sharded_router_ = std::make_unique<ShardedRouter>(*tc_, settings_, expected_route_queries_, diagnostics_);
+		return;
+	}
+	BuildGraph();
+	BuildRouter();
+}
+
+
+bool TransportRouter::IsSharded() const
+{
+	return tc_->GetRegionsCount() > 1;
+}
+
+
+bool TransportRouter::IsBuilt() const
+{
+	return router_ || crp_router_ || sharded_router_;
+}
+
+
+void TransportRouter::ResetRouters()
+{
+	router_.reset();
+	crp_router_.reset();
+	sharded_router_.reset();
+}
+
+
 //      (  )
 void TransportRouter::BuildGraph()
 {
-	int vertex_id = 0;
-
-	// 1.  .       
-	for (const auto& stop : tc_.GetAllStopsPtr())
+	//       -   
+	dw_graph_ = graph::DirectedWeightedGraph<double>(tc_->GetStopsCount() * 2);
+	// 1.  .     
+	for (transport_catalogue::StopId stop = 0; stop < tc_->GetStopsCount(); ++stop)
 	{
-		//      
-		vertexes_wait_.insert({ stop->name, vertex_id });
-		//       
-		vertexes_travel_.insert({ stop->name, ++vertex_id });
-		//   
+		//      
 		dw_graph_.AddEdge({
-				vertexes_wait_.at(stop->name),    // id
-				vertexes_travel_.at(stop->name),  // id
+				GetWaitVertex(stop),              // id
+				GetTravelVertex(stop),            // id
 				settings_.bus_wait_time * 1.0,    //  ==   (double)
-				stop->name,                       //   ==  
+				tc_->GetStopName(stop),            //   ==  
 				graph::EdgeType::WAIT,            //  
 				0                                 // span == 0   
 					   });
-		++vertex_id;
 	}
 
-	// 2.  .      
-	for (const auto& route : tc_.GetAllRoutesPtr())
+	// 2.  .       
+	for (const transport_catalogue::RouteId route : tc_->GetRoutesByName())
 	{
+		const transport_catalogue::RouteTraversal stops = tc_->GetRouteStops(route);
 		//     ( )      ...
-		for (size_t it_from = 0; it_from < route->stops.size() - 1; ++it_from)
+		for (size_t it_from = 0; it_from + 1 < stops.size(); ++it_from)
 		{
 			int span_count = 0;
 			// ...     
-			for (size_t it_to = it_from + 1; it_to < route->stops.size(); ++it_to)
+			for (size_t it_to = it_from + 1; it_to < stops.size(); ++it_to)
 			{
 				double road_distance = 0.0;
 				//  
 				for (size_t it = it_from + 1; it <= it_to; ++it)
 				{
-					road_distance += static_cast<double>(tc_.GetDistance(route->stops[it - 1], route->stops[it]));
+					road_distance += static_cast<double>(tc_->GetDistance(stops[it - 1], stops[it]));
 				}
 				//     ,       
 				//       
 				dw_graph_.AddEdge({
-						vertexes_travel_.at(route->stops[it_from]->name),
-						vertexes_wait_.at(route->stops[it_to]->name),
+						GetTravelVertex(stops[it_from]),
+						GetWaitVertex(stops[it_to]),
 						road_distance / (settings_.bus_velocity * 1000.0 / 60.0),    //  (==  )
-						route->route_name,
+						tc_->GetRouteName(route),
 						graph::EdgeType::TRAVEL,
 						++span_count     //    
 							   });
@@ -122,8 +379,202 @@ void TransportRouter::BuildGraph()
 		//         "-"
 	}
 
-	//       
-	router_ = std::make_unique<graph::Router<double>>(dw_graph_);
+}
+
+
+void TransportRouter::BuildRouter()
+{
+	if (GetActiveEngine() == RouterEngine::CRP)
+	{
+		//   (,    ) -   
+		if (partition_.empty())
+		{
+			BuildPartition();
+		}
+		crp_router_ = std::make_unique<graph::CrpRouter<double>>(dw_graph_, MakeGraphPartition());
+	}
+	else
+	{
+		//       
+		router_ = std::make_unique<graph::Router<double>>(dw_graph_);
+	}
+}
+
+
+RouterEngine TransportRouter::GetActiveEngine() const
+{
+	//    routing_settings      
+	return (settings_.engine == RouterEngine::AUTO) ? ChooseEngine() : settings_.engine;
+}
+
+
+RouterEngine TransportRouter::ChooseEngine() const
+{
+	//   (  ),      
+	// ,     .      
+	const double stops = static_cast<double>(tc_->GetStopsCount());
+	const double vertexes = static_cast<double>(dw_graph_.GetVertexCount());
+	const double edges = static_cast<double>(dw_graph_.GetEdgeCount());
+	const double queries = static_cast<double>(expected_route_queries_);
+	const double log_v = std::log2(std::max(vertexes, 2.0));
+	const double degree = edges / std::max(vertexes, 1.0);
+	const double cell_size = std::max(settings_.crp_cell_size, 1);
+	const double levels = std::max(settings_.crp_levels, 0);
+
+	// ALL_PAIRS:  V x V,  - V^3 ,  -  
+	const double all_pairs_memory = vertexes * vertexes * graph::Router<double>::GetMemoryPerVertexPair();
+	const double all_pairs_cost = vertexes * vertexes * vertexes + queries * log_v;
+	// CRP:        ,  - 
+	//   ,  -          
+	const double crp_memory = edges * (levels + 1.0) * CRP_BYTES_PER_EDGE_LEVEL;
+	const double crp_cost = edges * log_v * (levels + 1.0)
+		+ queries * degree * (2.0 * cell_size + (levels + 1.0) * std::sqrt(vertexes)) * log_v;
+	const double budget = settings_.memory_budget_mb * 1024.0 * 1024.0;
+
+	//      -  ,     - 
+	const bool all_pairs_fits = all_pairs_memory <= budget;
+	const bool crp_fits = crp_memory <= budget;
+	RouterEngine engine = RouterEngine::ALL_PAIRS;
+	if (all_pairs_fits && crp_fits)
+	{
+		engine = (crp_cost < all_pairs_cost) ? RouterEngine::CRP : RouterEngine::ALL_PAIRS;
+	}
+	else if (all_pairs_fits != crp_fits)
+	{
+		engine = crp_fits ? RouterEngine::CRP : RouterEngine::ALL_PAIRS;
+	}
+	else
+	{
+		engine = (crp_memory < all_pairs_memory) ? RouterEngine::CRP : RouterEngine::ALL_PAIRS;
+	}
+
+	if (!diagnostics_)
+	{
+		return engine;
+	}
+	*diagnostics_ << "router: auto engine selection: stops=" << stops
+		<< " vertexes=" << vertexes
+		<< " edges=" << edges
+		<< " route_queries=" << queries
+		<< " memory_budget_mb=" << settings_.memory_budget_mb
+		<< " all_pairs_memory_mb=" << all_pairs_memory / (1024.0 * 1024.0)
+		<< " crp_memory_mb=" << crp_memory / (1024.0 * 1024.0)
+		<< " all_pairs_cost=" << all_pairs_cost
+		<< " crp_cost=" << crp_cost
+		<< " -> " << (engine == RouterEngine::CRP ? "crp" : "all_pairs") << std::endl;
+	return engine;
+}
+
+
+void TransportRouter::BuildPartition()
+{
+	//       :   
+	//    ,     ,     
+
+	partition_.assign(tc_->GetStopsCount(), {});
+	std::vector<StopCode> stops;
+	stops.reserve(tc_->GetStopsCount());
+	for (transport_catalogue::StopId stop = 0; stop < tc_->GetStopsCount(); ++stop)
+	{
+		stops.push_back(StopCode{ stop, tc_->GetStopCoordinates(stop), 0U });
+	}
+	std::sort(stops.begin(), stops.end(), [this](const StopCode& lhs, const StopCode& rhs)
+			  {
+				  return tc_->GetStopName(lhs.id) < tc_->GetStopName(rhs.id);
+			  });
+
+	//  ,        crp_cell_size 
+	const size_t cell_size = static_cast<size_t>(std::max(settings_.crp_cell_size, 1));
+	size_t depth = 0;
+	while ((stops.size() + (size_t{ 1 } << depth) - 1) >> depth > cell_size)
+	{
+		++depth;
+	}
+	//     2^CRP_LEVEL_BITS  
+	const size_t levels = (depth == 0) ? 0
+		: std::min(static_cast<size_t>(std::max(settings_.crp_levels, 0)), (depth - 1) / CRP_LEVEL_BITS + 1);
+
+	BisectStops(stops.begin(), stops.end(), depth, 0U);
+
+	for (const StopCode& stop : stops)
+	{
+		std::vector<uint32_t> cells(levels);
+		for (size_t level = 0; level < levels; ++level)
+		{
+			cells[level] = stop.code >> (level * CRP_LEVEL_BITS);
+		}
+		partition_[stop.id] = std::move(cells);
+	}
+}
+
+
+const StopsPartition& TransportRouter::GetPartition() const
+{
+	return partition_;
+}
+
+
+void TransportRouter::ApplyPartition(StopsPartition partition)
+{
+	partition_ = std::move(partition);
+}
+
+
+void TransportRouter::ReportMemory(memory_report::MemoryReport& report)
+{
+	WaitForBuild();
+	report.Add("TransportRouter", "partition", memory_report::NestedVectorBytes(partition_));
+	report.Add("TransportRouter", "edges_buffer", memory_report::VectorBytes(edges_buffer_));
+	report.Add("TransportRouter", "legs_buffer", memory_report::VectorBytes(legs_buffer_));
+	dw_graph_.ReportMemory(report);
+	if (router_)
+	{
+		router_->ReportMemory(report);
+	}
+	if (crp_router_)
+	{
+		crp_router_->ReportMemory(report);
+	}
+	if (raptor_)
+	{
+		raptor_->ReportMemory(report);
+	}
+	if (sharded_router_)
+	{
+		sharded_router_->ReportMemory(report);
+	}
+}
+
+
+graph::Partition TransportRouter::MakeGraphPartition() const
+{
+	//    (  )     
+	size_t levels = 0;
+	for (const auto& cells : partition_)
+	{
+		levels = std::max(levels, cells.size());
+	}
+
+	graph::Partition result;
+	result.cells.assign(levels, std::vector<uint32_t>(dw_graph_.GetVertexCount(), 0U));
+	if (partition_.size() != tc_->GetStopsCount())
+	{
+		throw std::runtime_error("Stops partition doesn't match catalogue");
+	}
+	for (transport_catalogue::StopId stop_id = 0; stop_id < partition_.size(); ++stop_id)
+	{
+		const auto& cells = partition_[stop_id];
+		if (cells.size() != levels)
+		{
+			throw std::runtime_error("Stops partition doesn't match catalogue");
+		}
+		for (size_t level = 0; level < levels; ++level)
+		{
+			result.cells[level][GetWaitVertex(stop_id)] = cells[level];
+			result.cells[level][GetTravelVertex(stop_id)] = cells[level];
+		}
+	}
+	return result;
 }
 
 }
\ No newline at end of file
@@ -1,26 +1,51 @@
 #pragma once
 
 #include "domain.h"    //     
-#include "transport_catalogue.h"
+#include "frozen_catalogue.h"
 #include "router.h"
+#include "crp_router.h"
+#include "raptor.h"
+#include "sharded_router.h"
+#include <future>
 #include <memory>
+#include <ostream>
+#include <optional>
+#include <vector>
+#include <cstdint>
 
 
 
 namespace router
 {
 
+//   
+enum class RouterEngine
+{
+	ALL_PAIRS,    //        (graph::Router)
+	CRP,          // Customizable Route Planning:    +   (graph::CrpRouter)
+	AUTO,         //            
+};
+
 //   c  
 struct RouterSettings
 {
 	int bus_velocity = 40;
 	int bus_wait_time = 6;
+	RouterEngine engine = RouterEngine::AUTO;
+	int crp_cell_size = 32;    //         CRP
+	int crp_levels = 3;        //     CRP
+	int memory_budget_mb = 512;    //       , 
 };
 
-//  .       
+//       CRP.    ( - StopId) -
+//       .     (, )
+using StopsPartition = std::vector<std::vector<uint32_t>>;
+
+//  .       .
+//   : string_view       
 struct RouteItem
 {
-	std::string edge_name;    //    ( ),    ( )
+	std::string_view edge_name;    //    ( ),    ( )
 	int span_count = 0;       //    
 	double time = 0.0;        //  /    
 	graph::EdgeType type;     //  
@@ -39,24 +64,145 @@ struct RouteData
 class TransportRouter
 {
 public:
-	TransportRouter(transport_catalogue::TransportCatalogue&);
+	TransportRouter(const transport_catalogue::FrozenCatalogue&);
 
+	//  .   CRP  ,    
 	void ApplyRouterSettings(RouterSettings&);
 	RouterSettings GetRouterSettings() const;
+	//    .     
+	void SetExpectedRouteQueries(size_t);
+	//   :        .
+	// nullptr ( ) -   
+	void SetDiagnosticsOutput(std::ostream*);
+
+	// PROCESS_REQUESTS.        .  
+	//     ;     
+	void StartBuildAsync();
+
+	// PROCESS_REQUESTS.         .
+	//   ,   :   
+	//  CRP   ,     
+	//         .  
+	//     ,   
+	void UpdateCatalogue(const transport_catalogue::FrozenCatalogue&, transport_catalogue::CatalogueChanges);
 
-	//     
-	const RouteData CalculateRoute(const std::string_view, const std::string_view);
+	// MAKE_BASE.  -    CRP
+	void BuildPartition();
+	// SERIALIZER.   
+	const StopsPartition& GetPartition() const;
+	// DESERIALIZER.  ,    make_base
+	void ApplyPartition(StopsPartition);
+
+	//     : ,   , .
+	//    
+	void ReportMemory(memory_report::MemoryReport&);
+
+	//     .   max_transfers, 
+	//   RAPTOR       max_transfers 
+	const RouteData CalculateRoute(const std::string_view, const std::string_view,
+								   std::optional<size_t> max_transfers = std::nullopt);
+
+	//        visitor(const RouteItem&)  
+	//     .       nullopt,
+	//    .     :  ( RAPTOR,
+	//  )    ,    (Router, CrpRouter,
+	// Raptor, ShardedRouter)      ,   
+	//       
+	template <typename Visitor>
+	std::optional<double> VisitRoute(const std::string_view, const std::string_view, Visitor&& visitor,
+									 std::optional<size_t> max_transfers = std::nullopt);
 
 private:
-	void BuildGraph();    //       
+	//  :     -    ,      
+	void Build();
+	void BuildGraph();     //       
+	void BuildRouter();    //        
+	//    :   ShardedRouter,     
+	bool IsSharded() const;
+	bool IsBuilt() const;
+	void ResetRouters();
+	//      (   )
+	void WaitForBuild();
+	//    RouterEngine::AUTO    .  
+	//   ,   
+	RouterEngine ChooseEngine() const;
+	// ,     (   )
+	RouterEngine GetActiveEngine() const;
+	//       
+	graph::Partition MakeGraphPartition() const;
+	//      edges_buffer_.  false,   
+	bool FindRouteEdges(const std::string_view, const std::string_view);
+	//    RAPTOR    .  
+	//   legs_buffer_.      nullopt,   
+	std::optional<double> FindJourney(const std::string_view, const std::string_view, size_t);
+	//     .  std::out_of_range,   
+	transport_catalogue::StopId GetStopId(const std::string_view) const;
 
 	RouterSettings settings_;         //   -
-	transport_catalogue::TransportCatalogue& tc_;          //      
+	size_t expected_route_queries_ = 1;    //    
+	std::ostream* diagnostics_ = nullptr;  //   (nullptr -  )
+	const transport_catalogue::FrozenCatalogue* tc_;       //      (  UpdateCatalogue)
 
 	graph::DirectedWeightedGraph<double> dw_graph_;                //     double (  )
 	std::unique_ptr<graph::Router<double>> router_ = nullptr;      //        dw_graph_
-	std::unordered_map<std::string_view, size_t> vertexes_wait_;   //   "",    
-	std::unordered_map<std::string_view, size_t> vertexes_travel_; //    
+	std::unique_ptr<graph::CrpRouter<double>> crp_router_ = nullptr;    //   CRP     dw_graph_
+	StopsPartition partition_;                                      //      CRP
+	std::unique_ptr<ShardedRouter> sharded_router_ = nullptr;       //     (   )
+	std::unique_ptr<Raptor> raptor_ = nullptr;                      // RAPTOR      (  )
+	std::vector<graph::EdgeId> edges_buffer_;                      //     ()
+	std::vector<RaptorLeg> legs_buffer_;                           //    RAPTOR ()
+	//   .  ,    
+	//   ,       
+	std::future<void> build_future_;
 };
 
+template <typename Visitor>
+std::optional<double> TransportRouter::VisitRoute(const std::string_view from, const std::string_view to,
+												  Visitor&& visitor, std::optional<size_t> max_transfers)
+{
+	if (max_transfers)
+	{
+		//    RAPTOR -        
+		const auto journey_time = FindJourney(from, to, *max_transfers);
+		if (!journey_time)
+		{
+			return std::nullopt;
+		}
+		for (const auto& leg : legs_buffer_)
+		{
+			visitor(RouteItem{ tc_->GetStopName(leg.board_stop), 0, settings_.bus_wait_time * 1.0, graph::EdgeType::WAIT });
+			visitor(RouteItem{ tc_->GetRouteName(leg.route), leg.span_count, leg.ride_time, graph::EdgeType::TRAVEL });
+		}
+		return journey_time;
+	}
+
+	if (!FindRouteEdges(from, to))
+	{
+		return std::nullopt;
+	}
+	double total_time = 0.0;
+	if (sharded_router_)
+	{
+		//    :       
+		for (const ShardSegment& segment : sharded_router_->GetSegments())
+		{
+			total_time += segment.router->VisitRoute(segment.from, segment.to, visitor).value_or(0.0);
+		}
+		return total_time;
+	}
+	//     ,       
+	for (const graph::EdgeId edge_id : edges_buffer_)
+	{
+		const auto& edge = dw_graph_.GetEdge(edge_id);
+		//       
+		total_time += edge.weight;
+		visitor(RouteItem{
+			edge.edge_name,
+			(edge.type == graph::EdgeType::TRAVEL) ? edge.span_count : 0,
+			edge.weight,
+			edge.type });
+	}
+	return total_time;
+}
+
 }
\ No newline at end of file
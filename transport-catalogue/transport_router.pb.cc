@@ -25,6 +25,10 @@ PROTOBUF_CONSTEXPR RouterSettings::RouterSettings(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.bus_wait_time_)*/0
   , /*decltype(_impl_.bus_velocity_)*/0
+  , /*decltype(_impl_.engine_)*/0
+  , /*decltype(_impl_.crp_cell_size_)*/0
+  , /*decltype(_impl_.crp_levels_)*/0
+  , /*decltype(_impl_.memory_budget_mb_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct RouterSettingsDefaultTypeInternal {
   PROTOBUF_CONSTEXPR RouterSettingsDefaultTypeInternal()
@@ -35,9 +39,36 @@ struct RouterSettingsDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouterSettingsDefaultTypeInternal _RouterSettings_default_instance_;
+PROTOBUF_CONSTEXPR StopCells::StopCells(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cells_)*/{}
+  , /*decltype(_impl_._cells_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopCellsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopCellsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopCellsDefaultTypeInternal() {}
+  union {
+    StopCells _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopCellsDefaultTypeInternal _StopCells_default_instance_;
+PROTOBUF_CONSTEXPR RouterPartition::RouterPartition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RouterPartitionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouterPartitionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouterPartitionDefaultTypeInternal() {}
+  union {
+    RouterPartition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouterPartitionDefaultTypeInternal _RouterPartition_default_instance_;
 }  // namespace proto_serialization
-static ::_pb::Metadata file_level_metadata_transport_5frouter_2eproto[1];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_transport_5frouter_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_transport_5frouter_2eproto[3];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transport_5frouter_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5frouter_2eproto = nullptr;
 
 const uint32_t TableStruct_transport_5frouter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -49,25 +80,54 @@ const uint32_t TableStruct_transport_5frouter_2eproto::offsets[] PROTOBUF_SECTIO
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterSettings, _impl_.bus_wait_time_),
   PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterSettings, _impl_.bus_velocity_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterSettings, _impl_.engine_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterSettings, _impl_.crp_cell_size_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterSettings, _impl_.crp_levels_),
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterSettings, _impl_.memory_budget_mb_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::StopCells, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::StopCells, _impl_.cells_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterPartition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_serialization::RouterPartition, _impl_.stops_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::proto_serialization::RouterSettings)},
+  { 12, -1, -1, sizeof(::proto_serialization::StopCells)},
+  { 19, -1, -1, sizeof(::proto_serialization::RouterPartition)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::proto_serialization::_RouterSettings_default_instance_._instance,
+  &::proto_serialization::_StopCells_default_instance_._instance,
+  &::proto_serialization::_RouterPartition_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_transport_5frouter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\026transport_router.proto\022\023proto_serializ"
-  "ation\"=\n\016RouterSettings\022\025\n\rbus_wait_time"
-  "\030\001 \001(\005\022\024\n\014bus_velocity\030\002 \001(\005b\006proto3"
+  "ation\"\265\001\n\016RouterSettings\022\025\n\rbus_wait_tim"
+  "e\030\001 \001(\005\022\024\n\014bus_velocity\030\002 \001(\005\0221\n\006engine\030"
+  "\003 \001(\0162!.proto_serialization.RouterEngine"
+  "\022\025\n\rcrp_cell_size\030\004 \001(\005\022\022\n\ncrp_levels\030\005 "
+  "\001(\005\022\030\n\020memory_budget_mb\030\006 \001(\005\" \n\tStopCel"
+  "ls\022\r\n\005cells\030\002 \003(\rJ\004\010\001\020\002\"@\n\017RouterPartiti"
+  "on\022-\n\005stops\030\001 \003(\0132\036.proto_serialization."
+  "StopCells*0\n\014RouterEngine\022\r\n\tALL_PAIRS\020\000"
+  "\022\007\n\003CRP\020\001\022\010\n\004AUTO\020\002b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_transport_5frouter_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_transport_5frouter_2eproto = {
-    false, false, 116, descriptor_table_protodef_transport_5frouter_2eproto,
+    false, false, 387, descriptor_table_protodef_transport_5frouter_2eproto,
     "transport_router.proto",
-    &descriptor_table_transport_5frouter_2eproto_once, nullptr, 0, 1,
+    &descriptor_table_transport_5frouter_2eproto_once, nullptr, 0, 3,
     schemas, file_default_instances, TableStruct_transport_5frouter_2eproto::offsets,
     file_level_metadata_transport_5frouter_2eproto, file_level_enum_descriptors_transport_5frouter_2eproto,
     file_level_service_descriptors_transport_5frouter_2eproto,
@@ -79,6 +139,21 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transpor
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5frouter_2eproto(&descriptor_table_transport_5frouter_2eproto);
 namespace proto_serialization {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterEngine_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transport_5frouter_2eproto);
+  return file_level_enum_descriptors_transport_5frouter_2eproto[0];
+}
+bool RouterEngine_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -98,12 +173,16 @@ RouterSettings::RouterSettings(const RouterSettings& from)
   new (&_impl_) Impl_{
       decltype(_impl_.bus_wait_time_){}
     , decltype(_impl_.bus_velocity_){}
+    , decltype(_impl_.engine_){}
+    , decltype(_impl_.crp_cell_size_){}
+    , decltype(_impl_.crp_levels_){}
+    , decltype(_impl_.memory_budget_mb_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::memcpy(&_impl_.bus_wait_time_, &from._impl_.bus_wait_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bus_velocity_) -
-    reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.bus_velocity_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.memory_budget_mb_) -
+    reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.memory_budget_mb_));
   // @@protoc_insertion_point(copy_constructor:proto_serialization.RouterSettings)
 }
 
@@ -114,6 +193,10 @@ inline void RouterSettings::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.bus_wait_time_){0}
     , decltype(_impl_.bus_velocity_){0}
+    , decltype(_impl_.engine_){0}
+    , decltype(_impl_.crp_cell_size_){0}
+    , decltype(_impl_.crp_levels_){0}
+    , decltype(_impl_.memory_budget_mb_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
@@ -142,8 +225,8 @@ void RouterSettings::Clear() {
   (void) cached_has_bits;
 
   ::memset(&_impl_.bus_wait_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.bus_velocity_) -
-      reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.bus_velocity_));
+      reinterpret_cast<char*>(&_impl_.memory_budget_mb_) -
+      reinterpret_cast<char*>(&_impl_.bus_wait_time_)) + sizeof(_impl_.memory_budget_mb_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -169,6 +252,39 @@ const char* RouterSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext
         } else
           goto handle_unusual;
         continue;
+      // .proto_serialization.RouterEngine engine = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_engine(static_cast<::proto_serialization::RouterEngine>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 crp_cell_size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.crp_cell_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 crp_levels = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.crp_levels_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 memory_budget_mb = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.memory_budget_mb_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -210,6 +326,31 @@ uint8_t* RouterSettings::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_bus_velocity(), target);
   }
 
+  // .proto_serialization.RouterEngine engine = 3;
+  if (this->_internal_engine() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_engine(), target);
+  }
+
+  // int32 crp_cell_size = 4;
+  if (this->_internal_crp_cell_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_crp_cell_size(), target);
+  }
+
+  // int32 crp_levels = 5;
+  if (this->_internal_crp_levels() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_crp_levels(), target);
+  }
+
+  // int32 memory_budget_mb = 6;
+  if (this->_internal_memory_budget_mb() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_memory_budget_mb(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -236,6 +377,27 @@ size_t RouterSettings::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bus_velocity());
   }
 
+  // .proto_serialization.RouterEngine engine = 3;
+  if (this->_internal_engine() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_engine());
+  }
+
+  // int32 crp_cell_size = 4;
+  if (this->_internal_crp_cell_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_crp_cell_size());
+  }
+
+  // int32 crp_levels = 5;
+  if (this->_internal_crp_levels() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_crp_levels());
+  }
+
+  // int32 memory_budget_mb = 6;
+  if (this->_internal_memory_budget_mb() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_memory_budget_mb());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -260,6 +422,18 @@ void RouterSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   if (from._internal_bus_velocity() != 0) {
     _this->_internal_set_bus_velocity(from._internal_bus_velocity());
   }
+  if (from._internal_engine() != 0) {
+    _this->_internal_set_engine(from._internal_engine());
+  }
+  if (from._internal_crp_cell_size() != 0) {
+    _this->_internal_set_crp_cell_size(from._internal_crp_cell_size());
+  }
+  if (from._internal_crp_levels() != 0) {
+    _this->_internal_set_crp_levels(from._internal_crp_levels());
+  }
+  if (from._internal_memory_budget_mb() != 0) {
+    _this->_internal_set_memory_budget_mb(from._internal_memory_budget_mb());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -278,8 +452,8 @@ void RouterSettings::InternalSwap(RouterSettings* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RouterSettings, _impl_.bus_velocity_)
-      + sizeof(RouterSettings::_impl_.bus_velocity_)
+      PROTOBUF_FIELD_OFFSET(RouterSettings, _impl_.memory_budget_mb_)
+      + sizeof(RouterSettings::_impl_.memory_budget_mb_)
       - PROTOBUF_FIELD_OFFSET(RouterSettings, _impl_.bus_wait_time_)>(
           reinterpret_cast<char*>(&_impl_.bus_wait_time_),
           reinterpret_cast<char*>(&other->_impl_.bus_wait_time_));
@@ -291,6 +465,384 @@ void RouterSettings::InternalSwap(RouterSettings* other) {
       file_level_metadata_transport_5frouter_2eproto[0]);
 }
 
+// ===================================================================
+
+class StopCells::_Internal {
+ public:
+};
+
+StopCells::StopCells(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_serialization.StopCells)
+}
+StopCells::StopCells(const StopCells& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopCells* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cells_){from._impl_.cells_}
+    , /*decltype(_impl_._cells_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_serialization.StopCells)
+}
+
+inline void StopCells::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cells_){arena}
+    , /*decltype(_impl_._cells_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StopCells::~StopCells() {
+  // @@protoc_insertion_point(destructor:proto_serialization.StopCells)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StopCells::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cells_.~RepeatedField();
+}
+
+void StopCells::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StopCells::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_serialization.StopCells)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cells_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StopCells::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 cells = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_cells(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_cells(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StopCells::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_serialization.StopCells)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 cells = 2;
+  {
+    int byte_size = _impl_._cells_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_cells(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_serialization.StopCells)
+  return target;
+}
+
+size_t StopCells::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_serialization.StopCells)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 cells = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.cells_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._cells_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopCells::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StopCells::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopCells::GetClassData() const { return &_class_data_; }
+
+
+void StopCells::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopCells*>(&to_msg);
+  auto& from = static_cast<const StopCells&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_serialization.StopCells)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cells_.MergeFrom(from._impl_.cells_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StopCells::CopyFrom(const StopCells& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_serialization.StopCells)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StopCells::IsInitialized() const {
+  return true;
+}
+
+void StopCells::InternalSwap(StopCells* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cells_.InternalSwap(&other->_impl_.cells_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StopCells::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[1]);
+}
+
+// ===================================================================
+
+class RouterPartition::_Internal {
+ public:
+};
+
+RouterPartition::RouterPartition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_serialization.RouterPartition)
+}
+RouterPartition::RouterPartition(const RouterPartition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RouterPartition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){from._impl_.stops_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_serialization.RouterPartition)
+}
+
+inline void RouterPartition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RouterPartition::~RouterPartition() {
+  // @@protoc_insertion_point(destructor:proto_serialization.RouterPartition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RouterPartition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_.~RepeatedPtrField();
+}
+
+void RouterPartition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RouterPartition::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_serialization.RouterPartition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stops_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RouterPartition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto_serialization.StopCells stops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RouterPartition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_serialization.RouterPartition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto_serialization.StopCells stops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_serialization.RouterPartition)
+  return target;
+}
+
+size_t RouterPartition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_serialization.RouterPartition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto_serialization.StopCells stops = 1;
+  total_size += 1UL * this->_internal_stops_size();
+  for (const auto& msg : this->_impl_.stops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RouterPartition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RouterPartition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RouterPartition::GetClassData() const { return &_class_data_; }
+
+
+void RouterPartition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RouterPartition*>(&to_msg);
+  auto& from = static_cast<const RouterPartition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_serialization.RouterPartition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RouterPartition::CopyFrom(const RouterPartition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_serialization.RouterPartition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RouterPartition::IsInitialized() const {
+  return true;
+}
+
+void RouterPartition::InternalSwap(RouterPartition* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stops_.InternalSwap(&other->_impl_.stops_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RouterPartition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[2]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace proto_serialization
 PROTOBUF_NAMESPACE_OPEN
@@ -298,6 +850,14 @@ template<> PROTOBUF_NOINLINE ::proto_serialization::RouterSettings*
 Arena::CreateMaybeMessage< ::proto_serialization::RouterSettings >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto_serialization::RouterSettings >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proto_serialization::StopCells*
+Arena::CreateMaybeMessage< ::proto_serialization::StopCells >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_serialization::StopCells >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_serialization::RouterPartition*
+Arena::CreateMaybeMessage< ::proto_serialization::RouterPartition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_serialization::RouterPartition >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021001 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -45,15 +46,49 @@ struct TableStruct_transport_5frouter_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5frouter_2eproto;
 namespace proto_serialization {
+class RouterPartition;
+struct RouterPartitionDefaultTypeInternal;
+extern RouterPartitionDefaultTypeInternal _RouterPartition_default_instance_;
 class RouterSettings;
 struct RouterSettingsDefaultTypeInternal;
 extern RouterSettingsDefaultTypeInternal _RouterSettings_default_instance_;
+class StopCells;
+struct StopCellsDefaultTypeInternal;
+extern StopCellsDefaultTypeInternal _StopCells_default_instance_;
 }  // namespace proto_serialization
 PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_serialization::RouterPartition* Arena::CreateMaybeMessage<::proto_serialization::RouterPartition>(Arena*);
 template<> ::proto_serialization::RouterSettings* Arena::CreateMaybeMessage<::proto_serialization::RouterSettings>(Arena*);
+template<> ::proto_serialization::StopCells* Arena::CreateMaybeMessage<::proto_serialization::StopCells>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace proto_serialization {
 
+enum RouterEngine : int {
+  ALL_PAIRS = 0,
+  CRP = 1,
+  AUTO = 2,
+  RouterEngine_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RouterEngine_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RouterEngine_IsValid(int value);
+constexpr RouterEngine RouterEngine_MIN = ALL_PAIRS;
+constexpr RouterEngine RouterEngine_MAX = AUTO;
+constexpr int RouterEngine_ARRAYSIZE = RouterEngine_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterEngine_descriptor();
+template<typename T>
+inline const std::string& RouterEngine_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RouterEngine>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RouterEngine_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RouterEngine_descriptor(), enum_t_value);
+}
+inline bool RouterEngine_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RouterEngine* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RouterEngine>(
+    RouterEngine_descriptor(), name, value);
+}
 // ===================================================================
 
 class RouterSettings final :
@@ -179,6 +214,10 @@ class RouterSettings final :
   enum : int {
     kBusWaitTimeFieldNumber = 1,
     kBusVelocityFieldNumber = 2,
+    kEngineFieldNumber = 3,
+    kCrpCellSizeFieldNumber = 4,
+    kCrpLevelsFieldNumber = 5,
+    kMemoryBudgetMbFieldNumber = 6,
   };
   // int32 bus_wait_time = 1;
   void clear_bus_wait_time();
@@ -198,6 +237,42 @@ class RouterSettings final :
   void _internal_set_bus_velocity(int32_t value);
   public:
 
+  // .proto_serialization.RouterEngine engine = 3;
+  void clear_engine();
+  ::proto_serialization::RouterEngine engine() const;
+  void set_engine(::proto_serialization::RouterEngine value);
+  private:
+  ::proto_serialization::RouterEngine _internal_engine() const;
+  void _internal_set_engine(::proto_serialization::RouterEngine value);
+  public:
+
+  // int32 crp_cell_size = 4;
+  void clear_crp_cell_size();
+  int32_t crp_cell_size() const;
+  void set_crp_cell_size(int32_t value);
+  private:
+  int32_t _internal_crp_cell_size() const;
+  void _internal_set_crp_cell_size(int32_t value);
+  public:
+
+  // int32 crp_levels = 5;
+  void clear_crp_levels();
+  int32_t crp_levels() const;
+  void set_crp_levels(int32_t value);
+  private:
+  int32_t _internal_crp_levels() const;
+  void _internal_set_crp_levels(int32_t value);
+  public:
+
+  // int32 memory_budget_mb = 6;
+  void clear_memory_budget_mb();
+  int32_t memory_budget_mb() const;
+  void set_memory_budget_mb(int32_t value);
+  private:
+  int32_t _internal_memory_budget_mb() const;
+  void _internal_set_memory_budget_mb(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto_serialization.RouterSettings)
  private:
   class _Internal;
@@ -208,6 +283,329 @@ class RouterSettings final :
   struct Impl_ {
     int32_t bus_wait_time_;
     int32_t bus_velocity_;
+    int engine_;
+    int32_t crp_cell_size_;
+    int32_t crp_levels_;
+    int32_t memory_budget_mb_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StopCells final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_serialization.StopCells) */ {
+ public:
+  inline StopCells() : StopCells(nullptr) {}
+  ~StopCells() override;
+  explicit PROTOBUF_CONSTEXPR StopCells(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StopCells(const StopCells& from);
+  StopCells(StopCells&& from) noexcept
+    : StopCells() {
+    *this = ::std::move(from);
+  }
+
+  inline StopCells& operator=(const StopCells& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StopCells& operator=(StopCells&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StopCells& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StopCells* internal_default_instance() {
+    return reinterpret_cast<const StopCells*>(
+               &_StopCells_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(StopCells& a, StopCells& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StopCells* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StopCells* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StopCells* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StopCells>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StopCells& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StopCells& from) {
+    StopCells::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StopCells* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_serialization.StopCells";
+  }
+  protected:
+  explicit StopCells(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCellsFieldNumber = 2,
+  };
+  // repeated uint32 cells = 2;
+  int cells_size() const;
+  private:
+  int _internal_cells_size() const;
+  public:
+  void clear_cells();
+  private:
+  uint32_t _internal_cells(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_cells() const;
+  void _internal_add_cells(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_cells();
+  public:
+  uint32_t cells(int index) const;
+  void set_cells(int index, uint32_t value);
+  void add_cells(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      cells() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_cells();
+
+  // @@protoc_insertion_point(class_scope:proto_serialization.StopCells)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > cells_;
+    mutable std::atomic<int> _cells_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RouterPartition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_serialization.RouterPartition) */ {
+ public:
+  inline RouterPartition() : RouterPartition(nullptr) {}
+  ~RouterPartition() override;
+  explicit PROTOBUF_CONSTEXPR RouterPartition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RouterPartition(const RouterPartition& from);
+  RouterPartition(RouterPartition&& from) noexcept
+    : RouterPartition() {
+    *this = ::std::move(from);
+  }
+
+  inline RouterPartition& operator=(const RouterPartition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RouterPartition& operator=(RouterPartition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RouterPartition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RouterPartition* internal_default_instance() {
+    return reinterpret_cast<const RouterPartition*>(
+               &_RouterPartition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RouterPartition& a, RouterPartition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RouterPartition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RouterPartition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RouterPartition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RouterPartition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RouterPartition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RouterPartition& from) {
+    RouterPartition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RouterPartition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_serialization.RouterPartition";
+  }
+  protected:
+  explicit RouterPartition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStopsFieldNumber = 1,
+  };
+  // repeated .proto_serialization.StopCells stops = 1;
+  int stops_size() const;
+  private:
+  int _internal_stops_size() const;
+  public:
+  void clear_stops();
+  ::proto_serialization::StopCells* mutable_stops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::StopCells >*
+      mutable_stops();
+  private:
+  const ::proto_serialization::StopCells& _internal_stops(int index) const;
+  ::proto_serialization::StopCells* _internal_add_stops();
+  public:
+  const ::proto_serialization::StopCells& stops(int index) const;
+  ::proto_serialization::StopCells* add_stops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::StopCells >&
+      stops() const;
+
+  // @@protoc_insertion_point(class_scope:proto_serialization.RouterPartition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::StopCells > stops_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -264,14 +662,203 @@ inline void RouterSettings::set_bus_velocity(int32_t value) {
   // @@protoc_insertion_point(field_set:proto_serialization.RouterSettings.bus_velocity)
 }
 
+// .proto_serialization.RouterEngine engine = 3;
+inline void RouterSettings::clear_engine() {
+  _impl_.engine_ = 0;
+}
+inline ::proto_serialization::RouterEngine RouterSettings::_internal_engine() const {
+  return static_cast< ::proto_serialization::RouterEngine >(_impl_.engine_);
+}
+inline ::proto_serialization::RouterEngine RouterSettings::engine() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.RouterSettings.engine)
+  return _internal_engine();
+}
+inline void RouterSettings::_internal_set_engine(::proto_serialization::RouterEngine value) {
+  
+  _impl_.engine_ = value;
+}
+inline void RouterSettings::set_engine(::proto_serialization::RouterEngine value) {
+  _internal_set_engine(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.RouterSettings.engine)
+}
+
+// int32 crp_cell_size = 4;
+inline void RouterSettings::clear_crp_cell_size() {
+  _impl_.crp_cell_size_ = 0;
+}
+inline int32_t RouterSettings::_internal_crp_cell_size() const {
+  return _impl_.crp_cell_size_;
+}
+inline int32_t RouterSettings::crp_cell_size() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.RouterSettings.crp_cell_size)
+  return _internal_crp_cell_size();
+}
+inline void RouterSettings::_internal_set_crp_cell_size(int32_t value) {
+  
+  _impl_.crp_cell_size_ = value;
+}
+inline void RouterSettings::set_crp_cell_size(int32_t value) {
+  _internal_set_crp_cell_size(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.RouterSettings.crp_cell_size)
+}
+
+// int32 crp_levels = 5;
+inline void RouterSettings::clear_crp_levels() {
+  _impl_.crp_levels_ = 0;
+}
+inline int32_t RouterSettings::_internal_crp_levels() const {
+  return _impl_.crp_levels_;
+}
+inline int32_t RouterSettings::crp_levels() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.RouterSettings.crp_levels)
+  return _internal_crp_levels();
+}
+inline void RouterSettings::_internal_set_crp_levels(int32_t value) {
+  
+  _impl_.crp_levels_ = value;
+}
+inline void RouterSettings::set_crp_levels(int32_t value) {
+  _internal_set_crp_levels(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.RouterSettings.crp_levels)
+}
+
+// int32 memory_budget_mb = 6;
+inline void RouterSettings::clear_memory_budget_mb() {
+  _impl_.memory_budget_mb_ = 0;
+}
+inline int32_t RouterSettings::_internal_memory_budget_mb() const {
+  return _impl_.memory_budget_mb_;
+}
+inline int32_t RouterSettings::memory_budget_mb() const {
+  // @@protoc_insertion_point(field_get:proto_serialization.RouterSettings.memory_budget_mb)
+  return _internal_memory_budget_mb();
+}
+inline void RouterSettings::_internal_set_memory_budget_mb(int32_t value) {
+  
+  _impl_.memory_budget_mb_ = value;
+}
+inline void RouterSettings::set_memory_budget_mb(int32_t value) {
+  _internal_set_memory_budget_mb(value);
+  // @@protoc_insertion_point(field_set:proto_serialization.RouterSettings.memory_budget_mb)
+}
+
+// -------------------------------------------------------------------
+
+// StopCells
+
+// repeated uint32 cells = 2;
+inline int StopCells::_internal_cells_size() const {
+  return _impl_.cells_.size();
+}
+inline int StopCells::cells_size() const {
+  return _internal_cells_size();
+}
+inline void StopCells::clear_cells() {
+  _impl_.cells_.Clear();
+}
+inline uint32_t StopCells::_internal_cells(int index) const {
+  return _impl_.cells_.Get(index);
+}
+inline uint32_t StopCells::cells(int index) const {
+  // @@protoc_insertion_point(field_get:proto_serialization.StopCells.cells)
+  return _internal_cells(index);
+}
+inline void StopCells::set_cells(int index, uint32_t value) {
+  _impl_.cells_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_serialization.StopCells.cells)
+}
+inline void StopCells::_internal_add_cells(uint32_t value) {
+  _impl_.cells_.Add(value);
+}
+inline void StopCells::add_cells(uint32_t value) {
+  _internal_add_cells(value);
+  // @@protoc_insertion_point(field_add:proto_serialization.StopCells.cells)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+StopCells::_internal_cells() const {
+  return _impl_.cells_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+StopCells::cells() const {
+  // @@protoc_insertion_point(field_list:proto_serialization.StopCells.cells)
+  return _internal_cells();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+StopCells::_internal_mutable_cells() {
+  return &_impl_.cells_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+StopCells::mutable_cells() {
+  // @@protoc_insertion_point(field_mutable_list:proto_serialization.StopCells.cells)
+  return _internal_mutable_cells();
+}
+
+// -------------------------------------------------------------------
+
+// RouterPartition
+
+// repeated .proto_serialization.StopCells stops = 1;
+inline int RouterPartition::_internal_stops_size() const {
+  return _impl_.stops_.size();
+}
+inline int RouterPartition::stops_size() const {
+  return _internal_stops_size();
+}
+inline void RouterPartition::clear_stops() {
+  _impl_.stops_.Clear();
+}
+inline ::proto_serialization::StopCells* RouterPartition::mutable_stops(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_serialization.RouterPartition.stops)
+  return _impl_.stops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::StopCells >*
+RouterPartition::mutable_stops() {
+  // @@protoc_insertion_point(field_mutable_list:proto_serialization.RouterPartition.stops)
+  return &_impl_.stops_;
+}
+inline const ::proto_serialization::StopCells& RouterPartition::_internal_stops(int index) const {
+  return _impl_.stops_.Get(index);
+}
+inline const ::proto_serialization::StopCells& RouterPartition::stops(int index) const {
+  // @@protoc_insertion_point(field_get:proto_serialization.RouterPartition.stops)
+  return _internal_stops(index);
+}
+inline ::proto_serialization::StopCells* RouterPartition::_internal_add_stops() {
+  return _impl_.stops_.Add();
+}
+inline ::proto_serialization::StopCells* RouterPartition::add_stops() {
+  ::proto_serialization::StopCells* _add = _internal_add_stops();
+  // @@protoc_insertion_point(field_add:proto_serialization.RouterPartition.stops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_serialization::StopCells >&
+RouterPartition::stops() const {
+  // @@protoc_insertion_point(field_list:proto_serialization.RouterPartition.stops)
+  return _impl_.stops_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace proto_serialization
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto_serialization::RouterEngine> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto_serialization::RouterEngine>() {
+  return ::proto_serialization::RouterEngine_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>